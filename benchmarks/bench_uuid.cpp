@@ -0,0 +1,445 @@
+#include <catch2/catch_all.hpp>
+#include "uuid.h"
+#include "uuid_interner.h"
+#include "uuid_parallel.h"
+#include "uuid_views.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Compare MauUUIDBenchmarks against MauUUIDBenchmarksInstrumented to measure the instrumentation overhead.
+
+namespace
+{
+    // Counts the bytes currently allocated through it, to measure container memory
+    template <typename T>
+    struct CountingAllocator final
+    {
+        using value_type = T;
+
+        size_t* pBytes;
+
+        explicit CountingAllocator(size_t* bytes) noexcept : pBytes{ bytes } { }
+        template <typename U>
+        CountingAllocator(CountingAllocator<U> const& other) noexcept : pBytes{ other.pBytes } { }
+
+        T* allocate(size_t const count)
+        {
+            *pBytes += count * sizeof(T);
+            return std::allocator<T>{}.allocate(count);
+        }
+        void deallocate(T* p, size_t const count) noexcept
+        {
+            *pBytes -= count * sizeof(T);
+            std::allocator<T>{}.deallocate(p, count);
+        }
+
+        template <typename U>
+        bool operator==(CountingAllocator<U> const& other) const noexcept { return pBytes == other.pBytes; }
+    };
+
+    std::vector<std::string> MakeStrings(size_t const count)
+    {
+        std::vector<std::string> strings;
+        strings.reserve(count);
+        for (size_t i{ 0 }; i < count; ++i)
+        {
+            strings.emplace_back(MauUUID::UUID{}.Str());
+        }
+        return strings;
+    }
+
+    // TryParseLenient as it was before ParseAny: validates in one pass, copies the hex digits into a std::string and decodes in a second pass.
+    // Kept as the reference the single pass decoders are measured against.
+    bool ReferenceTryParseLenient(std::string_view const str, MauUUID::UUID& out)
+    {
+        size_t count{ 0 };
+        for (char const c : str)
+        {
+            if (c == '{' || c == '}' || c == '-' || c == ' ') continue;
+            if (MauUUID::HEX_LUT[static_cast<uint8_t>(c)] == 0xFF) return false;
+
+            ++count;
+        }
+        if (count != 32)
+        {
+            return false;
+        }
+
+        std::string cleaned;
+        cleaned.reserve(32);
+        for (char const c : str)
+        {
+            if (c == '{' || c == '}' || c == '-' || c == ' ') continue;
+            cleaned.push_back(c);
+        }
+
+        std::array<uint8_t, 16> bytes{};
+        for (size_t i{ 0 }; i < 16; ++i)
+        {
+            uint8_t const hi{ MauUUID::HEX_LUT[static_cast<uint8_t>(cleaned[i * 2])] };
+            uint8_t const lo{ MauUUID::HEX_LUT[static_cast<uint8_t>(cleaned[i * 2 + 1])] };
+            bytes[i] = static_cast<uint8_t>((hi << 4) | lo);
+        }
+
+        out = MauUUID::UUID{ bytes };
+        return true;
+    }
+}
+
+TEST_CASE("Benchmark generation", "[benchmark][generate]")
+{
+    BENCHMARK("Generate")
+    {
+        return MauUUID::UUID{};
+    };
+
+#ifdef MAU_UUID_INSTRUMENTATION
+    MauUUID::Instrumentation::SetLatencySampleInterval(64);
+    BENCHMARK("Generate (latency sampled 1/64)")
+    {
+        return MauUUID::UUID{};
+    };
+    MauUUID::Instrumentation::SetLatencySampleInterval(0);
+#endif
+}
+
+TEST_CASE("Benchmark bulk generation", "[benchmark][generate][views]")
+{
+    size_t constexpr COUNT{ 4096 };
+
+    BENCHMARK("emplace_back x4096")
+    {
+        std::vector<MauUUID::UUID> uuids;
+        uuids.reserve(COUNT);
+        for (size_t i{ 0 }; i < COUNT; ++i)
+        {
+            uuids.emplace_back();
+        }
+        return uuids.back();
+    };
+
+    std::vector<MauUUID::UUID> bulk(COUNT, MauUUID::null_uuid);
+    BENCHMARK("Generate(span) x4096")
+    {
+        MauUUID::UUID::Generate(bulk);
+        return bulk.back();
+    };
+
+    BENCHMARK("views::generate | take(4096)")
+    {
+        size_t checksum{ 0 };
+        for (auto const& uuid : MauUUID::views::generate() | std::views::take(COUNT))
+        {
+            checksum += uuid.Data()[15];
+        }
+        return checksum;
+    };
+}
+
+TEST_CASE("Benchmark parsing", "[benchmark][parse]")
+{
+    auto const strings{ MakeStrings(1024) };
+    std::string const lenient{ "{" + strings[0] + "}" };
+    size_t index{ 0 };
+
+    BENCHMARK("FromString")
+    {
+        return MauUUID::UUID::FromString(strings[index++ & 1023]);
+    };
+
+    BENCHMARK("TryParse (failure)")
+    {
+        MauUUID::UUID out{ MauUUID::null_uuid };
+        return MauUUID::UUID::TryParse("123e4567-e89b-12d3-a456-42661417400z", out);
+    };
+
+    BENCHMARK("FromStringLenient")
+    {
+        return MauUUID::UUID::FromStringLenient(lenient);
+    };
+
+    BENCHMARK("ParseAny (braced)")
+    {
+        return MauUUID::UUID::ParseAny(lenient);
+    };
+
+    BENCHMARK_ADVANCED("operator>>")(Catch::Benchmark::Chronometer meter)
+    {
+        std::istringstream iss{ strings[index++ & 1023] };
+        MauUUID::UUID out{ MauUUID::null_uuid };
+        meter.measure([&]
+        {
+            iss.clear();
+            iss.seekg(0);
+            iss >> out;
+            return out;
+        });
+    };
+}
+
+TEST_CASE("Benchmark lenient vs ParseAny", "[benchmark][parse][any]")
+{
+    auto const strings{ MakeStrings(1024) };
+
+    std::vector<std::string> braced;
+    std::vector<std::string> compact;
+    braced.reserve(strings.size());
+    compact.reserve(strings.size());
+    for (auto const& str : strings)
+    {
+        braced.emplace_back("{" + str + "}");
+        std::string hex{ str };
+        std::erase(hex, '-');
+        compact.emplace_back(std::move(hex));
+    }
+
+    std::vector<std::string_view> const column(braced.begin(), braced.end());
+    std::vector<std::optional<MauUUID::UUID>> out(column.size());
+    std::vector<MauUUID::UUID> parsed(column.size(), MauUUID::null_uuid);
+
+    BENCHMARK("Reference TryParseLenient x1024 (braced)")
+    {
+        for (size_t i{ 0 }; i < braced.size(); ++i)
+        {
+            (void)ReferenceTryParseLenient(braced[i], parsed[i]);
+        }
+        return parsed.back();
+    };
+
+    BENCHMARK("TryParseLenient x1024 (braced)")
+    {
+        for (size_t i{ 0 }; i < braced.size(); ++i)
+        {
+            (void)MauUUID::UUID::TryParseLenient(braced[i], parsed[i]);
+        }
+        return parsed.back();
+    };
+
+    BENCHMARK("ParseAny x1024 (braced)")
+    {
+        for (size_t i{ 0 }; i < braced.size(); ++i)
+        {
+            parsed[i] = MauUUID::UUID::ParseAny(braced[i]).value_or(MauUUID::null_uuid);
+        }
+        return parsed.back();
+    };
+
+    BENCHMARK("Reference TryParseLenient x1024 (compact)")
+    {
+        for (size_t i{ 0 }; i < compact.size(); ++i)
+        {
+            (void)ReferenceTryParseLenient(compact[i], parsed[i]);
+        }
+        return parsed.back();
+    };
+
+    BENCHMARK("TryParseLenient x1024 (compact)")
+    {
+        for (size_t i{ 0 }; i < compact.size(); ++i)
+        {
+            (void)MauUUID::UUID::TryParseLenient(compact[i], parsed[i]);
+        }
+        return parsed.back();
+    };
+
+    BENCHMARK("ParseAny x1024 (compact)")
+    {
+        for (size_t i{ 0 }; i < compact.size(); ++i)
+        {
+            parsed[i] = MauUUID::UUID::ParseAny(compact[i]).value_or(MauUUID::null_uuid);
+        }
+        return parsed.back();
+    };
+
+    BENCHMARK("ParseAny batch x1024 (braced)")
+    {
+        MauUUID::UUID::ParseAny(column, out);
+        return out.back();
+    };
+}
+
+// MauUUIDBenchmarks measures the shuffle picked at runtime (AVX2 where available), MauUUIDBenchmarksSSSE3 and MauUUIDBenchmarksScalar the other paths
+TEST_CASE("Benchmark GUID byte order conversion", "[benchmark][guid]")
+{
+    size_t constexpr COUNT{ 1 << 20 };
+
+    std::vector<MauUUID::UUID> uuids(COUNT, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(uuids);
+
+    std::vector<uint8_t> blob(COUNT * 16);
+
+    BENCHMARK("ToGuidBytes per UUID x1M")
+    {
+        for (size_t i{ 0 }; i < COUNT; ++i)
+        {
+            auto const bytes{ uuids[i].ToGuidBytes() };
+            std::memcpy(blob.data() + i * 16, bytes.data(), 16);
+        }
+        return blob.back();
+    };
+
+    BENCHMARK("ToGuidBytes bulk x1M")
+    {
+        MauUUID::UUID::ToGuidBytes(uuids, blob);
+        return blob.back();
+    };
+
+    BENCHMARK("FromGuidBytes bulk x1M")
+    {
+        MauUUID::UUID::FromGuidBytes(blob, uuids);
+        return uuids.back();
+    };
+
+    BENCHMARK("SwapGuidByteOrder in place x1M")
+    {
+        MauUUID::UUID::SwapGuidByteOrder(blob);
+        return blob.back();
+    };
+}
+
+TEST_CASE("Benchmark parallel scaling", "[benchmark][parallel]")
+{
+    size_t constexpr COUNT{ 1 << 20 };
+
+    std::vector<MauUUID::UUID> uuids(COUNT, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(uuids);
+
+    std::vector<std::array<char, 37>> strings(COUNT);
+    MauUUID::parallel::Format(uuids, strings);
+
+    std::vector<std::string_view> views;
+    views.reserve(COUNT);
+    for (auto const& str : strings)
+    {
+        views.emplace_back(str.data(), 36);
+    }
+
+    std::vector<std::optional<MauUUID::UUID>> parsed(COUNT);
+    std::vector<size_t> hashes(COUNT);
+
+    // 1, 2, 4, ... up to all cores
+    size_t const maxThreads{ std::max<size_t>(std::thread::hardware_concurrency(), 1) };
+    for (size_t threads{ 1 }; ; threads = std::min(threads * 2, maxThreads))
+    {
+        MauUUID::parallel::ThreadPool pool{ threads };
+        std::string const suffix{ " x1M threads=" + std::to_string(threads) };
+
+        BENCHMARK("parallel::Generate" + suffix)
+        {
+            MauUUID::parallel::Generate(uuids, pool);
+            return uuids.front();
+        };
+
+        BENCHMARK("parallel::Format" + suffix)
+        {
+            MauUUID::parallel::Format(uuids, strings, pool);
+            return strings.back();
+        };
+
+        BENCHMARK("parallel::Parse" + suffix)
+        {
+            return MauUUID::parallel::Parse(views, parsed, pool);
+        };
+
+        BENCHMARK("parallel::Hash" + suffix)
+        {
+            MauUUID::parallel::Hash(uuids, hashes, pool);
+            return hashes.back();
+        };
+
+        if (threads == maxThreads)
+        {
+            break;
+        }
+    }
+}
+
+TEST_CASE("Benchmark UUIDInterner vs unordered_map", "[benchmark][interner]")
+{
+    size_t constexpr COUNT{ 1 << 20 };
+    // Edges referencing the interned UUIDs, each edge stores 2 references
+    size_t constexpr EDGES{ COUNT * 8 };
+
+    std::vector<MauUUID::UUID> uuids(COUNT, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(uuids);
+
+    MauUUID::UUIDInterner interner{};
+    std::vector<uint32_t> handles(COUNT);
+    interner.InternMany(uuids, handles);
+
+    size_t mapBytes{ 0 };
+    using Map = std::unordered_map<MauUUID::UUID, uint32_t, std::hash<MauUUID::UUID>, std::equal_to<>, CountingAllocator<std::pair<MauUUID::UUID const, uint32_t>>>;
+    Map map{ 0, std::hash<MauUUID::UUID>{}, std::equal_to<>{}, CountingAllocator<std::pair<MauUUID::UUID const, uint32_t>>{ &mapBytes } };
+    for (size_t i{ 0 }; i < COUNT; ++i)
+    {
+        map.emplace(uuids[i], static_cast<uint32_t>(i));
+    }
+
+    size_t const internerBytes{ interner.MemoryUsage() };
+    size_t const savedBytes{ EDGES * 2 * (sizeof(MauUUID::UUID) - sizeof(uint32_t)) };
+    std::cout << "UUIDs: " << COUNT << ", edges: " << EDGES << "\n"
+        << "UUIDInterner:       " << internerBytes / COUNT << " bytes per UUID (" << internerBytes / (1024 * 1024) << " MiB)\n"
+        << "unordered_map:      " << mapBytes / COUNT << " bytes per UUID (" << mapBytes / (1024 * 1024) << " MiB, excluding malloc overhead)\n"
+        << "Edge references:    " << savedBytes / (1024 * 1024) << " MiB saved by storing uint32_t handles\n";
+
+    // Random lookup order, so both containers pay for cache misses
+    std::vector<MauUUID::UUID> queries{ uuids };
+    std::ranges::shuffle(queries, std::mt19937_64{ 42 });
+
+    BENCHMARK("unordered_map find x1M")
+    {
+        uint64_t sum{ 0 };
+        for (auto const& uuid : queries)
+        {
+            sum += map.find(uuid)->second;
+        }
+        return sum;
+    };
+
+    BENCHMARK("UUIDInterner Find x1M")
+    {
+        uint64_t sum{ 0 };
+        for (auto const& uuid : queries)
+        {
+            sum += *interner.Find(uuid);
+        }
+        return sum;
+    };
+
+    BENCHMARK("UUIDInterner InternMany x1M (all present)")
+    {
+        interner.InternMany(queries, handles);
+        return handles.back();
+    };
+
+    interner.Freeze();
+
+    BENCHMARK("UUIDInterner Find x1M (frozen)")
+    {
+        uint64_t sum{ 0 };
+        for (auto const& uuid : queries)
+        {
+            sum += *interner.Find(uuid);
+        }
+        return sum;
+    };
+
+    BENCHMARK("UUIDInterner Get x1M (frozen)")
+    {
+        uint64_t sum{ 0 };
+        for (size_t i{ 0 }; i < COUNT; ++i)
+        {
+            sum += interner.Get(handles[i]).Data()[0];
+        }
+        return sum;
+    };
+}
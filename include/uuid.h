@@ -7,10 +7,12 @@
 #include <cstdint>
 #include <cstring>
 #include <istream>
+#include <optional>
 #include <ostream>
 #include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 #ifndef MAU_UUID_USE_RANDOM
 	#ifdef _WIN32
@@ -22,9 +24,12 @@
 			#define MAU_UUID_USE_RANDOM
 		#else
 			#include <uuid/uuid.h>
+			#include <cstdlib>
 		#endif
 	#elif defined(__linux__) && !defined(__ANDROID__)
 		#include <uuid/uuid.h>
+		#include <cerrno>
+		#include <sys/random.h>
 	#else
 		#define MAU_UUID_USE_RANDOM
 	#endif
@@ -34,6 +39,21 @@
 	#include <random>
 #endif
 
+// With GCC/Clang on x86 the SIMD paths are compiled with target attributes and picked at runtime, define MAU_UUID_NO_CPU_DISPATCH to only use the ones enabled at compile time.
+// Not with clang-cl: __builtin_cpu_supports needs compiler-rt, which the MSVC linker does not pull in.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER) && !defined(MAU_UUID_NO_CPU_DISPATCH)
+	#define MAU_UUID_CPU_DISPATCH
+	#define MAU_UUID_TARGET(isa) [[gnu::target(isa)]]
+#else
+	#define MAU_UUID_TARGET(isa)
+#endif
+
+#if defined(__AVX2__) || defined(__SSSE3__) || defined(MAU_UUID_CPU_DISPATCH)
+	#include <immintrin.h>
+#endif
+
+#include "uuid_instrumentation.h"
+
 namespace MauUUID
 {
 	static std::array<uint8_t, 256> constexpr CreateHexLUT()
@@ -70,6 +90,34 @@ namespace MauUUID
 
 	static constexpr std::array<uint8_t, 256> HEX_LUT{ CreateHexLUT() };
 
+	// Accepts both the standard ('+', '/') and the URL-safe ('-', '_') alphabet
+	static std::array<uint8_t, 256> constexpr CreateBase64LUT()
+	{
+		std::array<uint8_t, 256> lut{};
+		lut.fill(0xFF);
+
+		for (char c{ 'A' }; c <= 'Z'; ++c)
+		{
+			lut[static_cast<uint8_t>(c)] = c - 'A';
+		}
+		for (char c{ 'a' }; c <= 'z'; ++c)
+		{
+			lut[static_cast<uint8_t>(c)] = c - 'a' + 26;
+		}
+		for (char c{ '0' }; c <= '9'; ++c)
+		{
+			lut[static_cast<uint8_t>(c)] = c - '0' + 52;
+		}
+		lut[static_cast<uint8_t>('+')] = 62;
+		lut[static_cast<uint8_t>('-')] = 62;
+		lut[static_cast<uint8_t>('/')] = 63;
+		lut[static_cast<uint8_t>('_')] = 63;
+
+		return lut;
+	}
+
+	static constexpr std::array<uint8_t, 256> BASE64_LUT{ CreateBase64LUT() };
+
 	class UUID final
 	{
 	public:
@@ -102,24 +150,11 @@ namespace MauUUID
 		 */
 		UUID() noexcept
 		{
-			static thread_local std::mt19937_64 rng{ []
-			{
-				std::random_device rd;
-				return (static_cast<uint64_t>(rd()) << 32) | rd();
-			}() };
-
-			std::uniform_int_distribution<uint64_t> dist;
-
-			uint64_t const a{ dist(rng) };
-			uint64_t const b{ dist(rng) };
+			MAU_UUID_TIME_GENERATE();
 
-			std::memcpy(m_Bytes.data(), &a, 8);
-			std::memcpy(m_Bytes.data() + 8, &b, 8);
+			FillRandom(RandomEngine());
 
-			// RFC 4122 version 4 (random)
-			m_Bytes[6] = (m_Bytes[6] & 0x0F) | 0x40;
-			// RFC 4122 variant 1
-			m_Bytes[8] = (m_Bytes[8] & 0x3F) | 0x80;
+			MAU_UUID_RECORD_GENERATE(Random, 1);
 		}
 	#elif defined(_WIN32)
 		/**
@@ -127,6 +162,8 @@ namespace MauUUID
 		 */
 		UUID() noexcept
 		{
+			MAU_UUID_TIME_GENERATE();
+
 			GUID guid;
 
 			#ifdef _DEBUG
@@ -139,18 +176,10 @@ namespace MauUUID
 			static_assert(sizeof(GUID) == 16, "GUID size mismatch");
 
 			// Note: Windows stores GUID as little-endian for first 3 fields (RFC wants big-endian)
-			m_Bytes[0] = static_cast<uint8_t>(guid.Data1 >> 24);
-			m_Bytes[1] = static_cast<uint8_t>(guid.Data1 >> 16);
-			m_Bytes[2] = static_cast<uint8_t>(guid.Data1 >> 8);
-			m_Bytes[3] = static_cast<uint8_t>(guid.Data1);
-
-			m_Bytes[4] = static_cast<uint8_t>(guid.Data2 >> 8);
-			m_Bytes[5] = static_cast<uint8_t>(guid.Data2);
+			ShuffleGuidBytes(reinterpret_cast<uint8_t const*>(&guid), m_Bytes.data(), 1);
 
-			m_Bytes[6] = static_cast<uint8_t>(guid.Data3 >> 8);
-			m_Bytes[7] = static_cast<uint8_t>(guid.Data3);
-
-			std::memcpy(&m_Bytes[8], guid.Data4, 8);
+			MAU_UUID_RECORD_ENTROPY_REQUESTS(1);
+			MAU_UUID_RECORD_GENERATE(Windows, 1);
 		}
 	#else
 		/**
@@ -158,10 +187,69 @@ namespace MauUUID
 		 */
 		UUID() noexcept
 		{
+			MAU_UUID_TIME_GENERATE();
+
 			uuid_generate(m_Bytes.data());
+
+			MAU_UUID_RECORD_ENTROPY_REQUESTS(1);
+			MAU_UUID_RECORD_GENERATE(LibUUID, 1);
 		}
 	#endif
 
+		/**
+		 * @brief Generate a new UUID into every element of out.
+		 * With libuuid (Linux, macOS) all random bytes come from one system entropy request (getrandom/arc4random_buf) instead of one per UUID,
+		 * with the portable backend the thread local engine is looked up once. On Windows every UUID is still a separate CoCreateGuid call.
+		 * @param out UUIDs to overwrite with newly generated ones.
+		 */
+		static void Generate(std::span<UUID> const out) noexcept
+		{
+		#ifdef MAU_UUID_USE_RANDOM
+			// Look up the thread local engine once for the whole batch
+			auto& rng{ RandomEngine() };
+			for (auto& uuid : out)
+			{
+				uuid.FillRandom(rng);
+			}
+
+			MAU_UUID_RECORD_GENERATE(Random, out.size());
+		#elif defined(_WIN32)
+			for (auto& uuid : out)
+			{
+				uuid = UUID{};
+			}
+		#else
+			static_assert(sizeof(UUID) == 16 && std::is_trivially_copyable_v<UUID>, "UUID must be 16 plain bytes");
+
+			if (out.empty())
+			{
+				return;
+			}
+
+			if (FillEntropy(reinterpret_cast<uint8_t*>(out.data()), out.size_bytes()))
+			{
+				for (auto& uuid : out)
+				{
+					uuid.SetVersion4();
+				}
+
+				MAU_UUID_RECORD_ENTROPY_REQUESTS(1);
+				MAU_UUID_RECORD_GENERATE(SystemEntropy, out.size());
+			}
+			else
+			{
+				// No system entropy call available (e.g. kernel without getrandom), let libuuid pick its source per UUID
+				for (auto& uuid : out)
+				{
+					uuid_generate(uuid.m_Bytes.data());
+				}
+
+				MAU_UUID_RECORD_ENTROPY_REQUESTS(out.size());
+				MAU_UUID_RECORD_GENERATE(LibUUID, out.size());
+			}
+		#endif
+		}
+
 		~UUID() = default;
 		UUID(UUID const&) noexcept = default;
 		UUID(UUID&&) noexcept = default;
@@ -272,13 +360,12 @@ namespace MauUUID
 		{
 			assert(IsValidString(str) && "Invalid UUID format!");
 
-			UUID uuid;
+			MAU_UUID_TIME_PARSE(FromString);
+			MAU_UUID_RECORD_PARSE(FromString, true);
 
-			for (size_t i{ 0 }; i < 16; ++i)
-			{
-				auto [hi, lo] = HEX_PAIRS[i];
-				uuid.m_Bytes[i] = (HEX_LUT[static_cast<uint8_t>(str[hi])] << 4) | HEX_LUT[static_cast<uint8_t>(str[lo])];
-			}
+			UUID uuid{ std::array<uint8_t, 16>{} };
+			// Validated by the assert above
+			static_cast<void>(DecodeCanonical(str.data(), uuid));
 
 			return uuid;
 		}
@@ -290,24 +377,12 @@ namespace MauUUID
 		 */
 		[[nodiscard]] static UUID FromStringLenient(std::string_view const str) noexcept
 		{
-			assert(IsValidStringLenient(str));
+			MAU_UUID_TIME_PARSE(FromStringLenient);
+			MAU_UUID_RECORD_PARSE(FromStringLenient, true);
 
-			std::string cleaned;
-			cleaned.reserve(32);
-
-			for (char const c : str)
-			{
-				if (c == '{' || c == '}' || c == '-' || c == ' ') continue;
-				cleaned.push_back(c);
-			}
-
-			UUID uuid;
-			for (size_t i{ 0 }; i < 16; ++i)
-			{
-				uint8_t const hi{ HEX_LUT[static_cast<uint8_t>(cleaned[i * 2])] };
-				uint8_t const lo{ HEX_LUT[static_cast<uint8_t>(cleaned[i * 2 + 1])] };
-				uuid.m_Bytes[i] = (hi << 4) | lo;
-			}
+			UUID uuid{ std::array<uint8_t, 16>{} };
+			[[maybe_unused]] bool const valid{ DecodeLenient(str, uuid) };
+			assert(valid && "Invalid UUID format!");
 
 			return uuid;
 		}
@@ -319,11 +394,17 @@ namespace MauUUID
 		 */
 		[[nodiscard]] static bool TryParse(std::string_view const str, UUID& out) noexcept
 		{
-			if (!IsValidString(str))
+			MAU_UUID_TIME_PARSE(FromString);
+
+			UUID uuid{ std::array<uint8_t, 16>{} };
+			if (str.size() != 36 || !DecodeCanonical(str.data(), uuid))
 			{
+				MAU_UUID_RECORD_PARSE(FromString, false);
 				return false;
 			}
-			out = FromString(str);
+
+			MAU_UUID_RECORD_PARSE(FromString, true);
+			out = uuid;
 			return true;
 		}
 		/**
@@ -334,14 +415,84 @@ namespace MauUUID
 		 */
 		[[nodiscard]] static bool TryParseLenient(std::string_view const str, UUID& out) noexcept
 		{
-			if (!IsValidStringLenient(str))
+			MAU_UUID_TIME_PARSE(FromStringLenient);
+
+			UUID uuid{ std::array<uint8_t, 16>{} };
+			if (!DecodeLenient(str, uuid))
 			{
+				MAU_UUID_RECORD_PARSE(FromStringLenient, false);
 				return false;
 			}
 
-			out = FromStringLenient(str);
+			MAU_UUID_RECORD_PARSE(FromStringLenient, true);
+			out = uuid;
 			return true;
 		}
+		/**
+		 * @brief Parse a UUID in any supported format, the format is detected from the length and first bytes.
+		 * Supported formats: "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx", "{xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}", "urn:uuid:xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx",
+		 * 32 hexadecimal characters without dashes and Base64 (22 characters, or 24 with "==" padding, standard or URL-safe alphabet).
+		 * Hexadecimal characters may be upper or lower case. Does not allocate and scans the input once.
+		 * @param str String to parse into a UUID.
+		 * @return The parsed UUID, or std::nullopt if the string is not in a supported format.
+		 */
+		[[nodiscard]] static std::optional<UUID> ParseAny(std::string_view const str) noexcept
+		{
+			MAU_UUID_TIME_PARSE(Any);
+
+			UUID uuid{ std::array<uint8_t, 16>{} };
+			bool valid{ false };
+
+			switch (str.size())
+			{
+			case 36:
+				valid = DecodeCanonical(str.data(), uuid);
+				break;
+			case 38:
+				valid = str.front() == '{' && str.back() == '}' && DecodeCanonical(str.data() + 1, uuid);
+				break;
+			case 45:
+				valid = HasUrnPrefix(str) && DecodeCanonical(str.data() + 9, uuid);
+				break;
+			case 32:
+				valid = DecodeHex(str.data(), uuid);
+				break;
+			case 24:
+				valid = str[22] == '=' && str[23] == '=' && DecodeBase64(str.data(), uuid);
+				break;
+			case 22:
+				valid = DecodeBase64(str.data(), uuid);
+				break;
+			default:
+				break;
+			}
+
+			MAU_UUID_RECORD_PARSE(Any, valid);
+
+			if (!valid)
+			{
+				return std::nullopt;
+			}
+			return uuid;
+		}
+		/**
+		 * @brief Parse a column of strings with ParseAny.
+		 * @param strs Strings to parse.
+		 * @param out Output, out[i] receives the result for strs[i]. Must be at least as large as strs.
+		 * @return Number of strings that were parsed successfully.
+		 */
+		static size_t ParseAny(std::span<std::string_view const> const strs, std::span<std::optional<UUID>> const out) noexcept
+		{
+			assert(out.size() >= strs.size() && "Output span too small!");
+
+			size_t parsed{ 0 };
+			for (size_t i{ 0 }; i < strs.size(); ++i)
+			{
+				out[i] = ParseAny(strs[i]);
+				parsed += out[i].has_value();
+			}
+			return parsed;
+		}
 		/**
 		 * @brief Check if a string is a valid UUID in the format "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx".
 		 * @param str String to check.
@@ -376,6 +527,66 @@ namespace MauUUID
 			return count == 32;
 		}
 #pragma endregion
+#pragma region GUID byte order
+		// GUID byte order is the in-memory layout of a Windows GUID, also used by .NET Guid.ToByteArray() and SQL Server uniqueidentifier:
+		// Data1 (4 bytes), Data2 and Data3 (2 bytes each) are little-endian, Data4 (8 bytes) is stored as is.
+
+		/**
+		 * @brief Create a UUID from 16 bytes in GUID byte order.
+		 * @param bytes Bytes in GUID byte order.
+		 * @return UUID object in RFC byte order.
+		 */
+		[[nodiscard]] static UUID FromGuidBytes(std::span<uint8_t const, 16> const bytes) noexcept
+		{
+			UUID uuid{ std::array<uint8_t, 16>{} };
+			ShuffleGuidBytes(bytes.data(), uuid.m_Bytes.data(), 1);
+			return uuid;
+		}
+		/**
+		 * @brief Get the bytes of the UUID in GUID byte order.
+		 * @return Copy of the internal byte array in GUID byte order.
+		 */
+		[[nodiscard]] std::array<uint8_t, 16> ToGuidBytes() const noexcept
+		{
+			std::array<uint8_t, 16> result{};
+			ShuffleGuidBytes(m_Bytes.data(), result.data(), 1);
+			return result;
+		}
+		/**
+		 * @brief Convert a buffer of 16 byte records in GUID byte order to UUIDs.
+		 * @param in Records in GUID byte order, the size must be a multiple of 16.
+		 * @param out Output, must hold at least in.size() / 16 UUIDs.
+		 */
+		static void FromGuidBytes(std::span<uint8_t const> const in, std::span<UUID> const out) noexcept
+		{
+			assert(in.size() % 16 == 0 && "Input size must be a multiple of 16!");
+			assert(out.size() >= in.size() / 16 && "Output span too small!");
+
+			ShuffleGuidBytes(in.data(), reinterpret_cast<uint8_t*>(out.data()), in.size() / 16);
+		}
+		/**
+		 * @brief Convert UUIDs to a buffer of 16 byte records in GUID byte order.
+		 * @param in UUIDs to convert.
+		 * @param out Output, must hold at least in.size() * 16 bytes.
+		 */
+		static void ToGuidBytes(std::span<UUID const> const in, std::span<uint8_t> const out) noexcept
+		{
+			assert(out.size() >= in.size() * 16 && "Output span too small!");
+
+			ShuffleGuidBytes(reinterpret_cast<uint8_t const*>(in.data()), out.data(), in.size());
+		}
+		/**
+		 * @brief Convert a buffer of 16 byte records between GUID and RFC byte order in place, e.g. over an mmap'd file.
+		 * The conversion is its own inverse, the same call converts in either direction.
+		 * @param bytes Records to convert, the size must be a multiple of 16.
+		 */
+		static void SwapGuidByteOrder(std::span<uint8_t> const bytes) noexcept
+		{
+			assert(bytes.size() % 16 == 0 && "Size must be a multiple of 16!");
+
+			ShuffleGuidBytes(bytes.data(), bytes.data(), bytes.size() / 16);
+		}
+#pragma endregion
 #pragma region operators
 		[[nodiscard]] auto operator<=>(UUID const& other) const noexcept
 		{
@@ -387,10 +598,230 @@ namespace MauUUID
 		{
 			return !IsNull();
 		}
+
+		friend std::istream& operator>>(std::istream& is, UUID& uuid);
 #pragma endregion
 
 	private:
 		std::array<uint8_t, 16> m_Bytes;
+
+	#ifdef MAU_UUID_USE_RANDOM
+		[[nodiscard]] static std::mt19937_64& RandomEngine() noexcept
+		{
+			static thread_local std::mt19937_64 rng{ []
+			{
+				MAU_UUID_RECORD_ENTROPY_REQUESTS(1);
+				std::random_device rd;
+				return (static_cast<uint64_t>(rd()) << 32) | rd();
+			}() };
+			return rng;
+		}
+		void FillRandom(std::mt19937_64& rng) noexcept
+		{
+			std::uniform_int_distribution<uint64_t> dist;
+
+			uint64_t const a{ dist(rng) };
+			uint64_t const b{ dist(rng) };
+
+			std::memcpy(m_Bytes.data(), &a, 8);
+			std::memcpy(m_Bytes.data() + 8, &b, 8);
+
+			SetVersion4();
+		}
+	#elif !defined(_WIN32)
+		// Fills size bytes from the system CSPRNG in as few calls as possible, false if it is not available
+		[[nodiscard]] static bool FillEntropy(uint8_t* data, size_t size) noexcept
+		{
+		#ifdef __APPLE__
+			arc4random_buf(data, size);
+			return true;
+		#else
+			while (size > 0)
+			{
+				// Requests above 32 MiB may return fewer bytes, as can signals, so loop until everything is filled
+				ssize_t const filled{ getrandom(data, size, 0) };
+				if (filled < 0)
+				{
+					if (errno == EINTR) continue;
+					return false;
+				}
+
+				data += filled;
+				size -= static_cast<size_t>(filled);
+			}
+			return true;
+		#endif
+		}
+	#endif
+		// Turns 16 random bytes into a valid random UUID
+		void SetVersion4() noexcept
+		{
+			// RFC 4122 version 4 (random)
+			m_Bytes[6] = (m_Bytes[6] & 0x0F) | 0x40;
+			// RFC 4122 variant 1
+			m_Bytes[8] = (m_Bytes[8] & 0x3F) | 0x80;
+		}
+		// The decoders below validate while decoding: invalid characters map to 0xFF in the lookup tables,
+		// so OR-ing every looked up value together and checking the high bits validates the whole input in the same pass.
+
+		// Decodes "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx", str must point to at least 36 characters
+		[[nodiscard]] static bool DecodeCanonical(char const* str, UUID& out) noexcept
+		{
+			if (str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') return false;
+
+			uint8_t invalid{ 0 };
+			for (size_t i{ 0 }; i < 16; ++i)
+			{
+				auto [hi, lo] = HEX_PAIRS[i];
+				uint8_t const high{ HEX_LUT[static_cast<uint8_t>(str[hi])] };
+				uint8_t const low{ HEX_LUT[static_cast<uint8_t>(str[lo])] };
+				invalid |= high | low;
+				out.m_Bytes[i] = static_cast<uint8_t>((high << 4) | low);
+			}
+			return (invalid & 0xF0) == 0;
+		}
+		// Decodes 32 hex digits without separators, str must point to at least 32 characters
+		[[nodiscard]] static bool DecodeHex(char const* str, UUID& out) noexcept
+		{
+			uint8_t invalid{ 0 };
+			for (size_t i{ 0 }; i < 16; ++i)
+			{
+				uint8_t const high{ HEX_LUT[static_cast<uint8_t>(str[i * 2])] };
+				uint8_t const low{ HEX_LUT[static_cast<uint8_t>(str[i * 2 + 1])] };
+				invalid |= high | low;
+				out.m_Bytes[i] = static_cast<uint8_t>((high << 4) | low);
+			}
+			return (invalid & 0xF0) == 0;
+		}
+		// Decodes 22 Base64 characters (128 bits + 4 padding bits), str must point to at least 22 characters
+		[[nodiscard]] static bool DecodeBase64(char const* str, UUID& out) noexcept
+		{
+			uint8_t invalid{ 0 };
+
+			// 5 groups of 4 characters hold the first 15 bytes
+			for (size_t group{ 0 }; group < 5; ++group)
+			{
+				char const* in{ str + group * 4 };
+				uint8_t const a{ BASE64_LUT[static_cast<uint8_t>(in[0])] };
+				uint8_t const b{ BASE64_LUT[static_cast<uint8_t>(in[1])] };
+				uint8_t const c{ BASE64_LUT[static_cast<uint8_t>(in[2])] };
+				uint8_t const d{ BASE64_LUT[static_cast<uint8_t>(in[3])] };
+				invalid |= a | b | c | d;
+
+				uint32_t const bits{ (uint32_t{ a } << 18) | (uint32_t{ b } << 12) | (uint32_t{ c } << 6) | d };
+				out.m_Bytes[group * 3] = static_cast<uint8_t>(bits >> 16);
+				out.m_Bytes[group * 3 + 1] = static_cast<uint8_t>(bits >> 8);
+				out.m_Bytes[group * 3 + 2] = static_cast<uint8_t>(bits);
+			}
+
+			// The last 2 characters hold the final byte, the low 4 bits of the last character must be zero
+			uint8_t const a{ BASE64_LUT[static_cast<uint8_t>(str[20])] };
+			uint8_t const b{ BASE64_LUT[static_cast<uint8_t>(str[21])] };
+			invalid |= a | b;
+			out.m_Bytes[15] = static_cast<uint8_t>((a << 2) | (b >> 4));
+
+			return (invalid & 0xC0) == 0 && (b & 0x0F) == 0;
+		}
+		// Decodes while skipping '{', '}', '-' and ' ', fails on any other non-hex character or if there are not exactly 32 hex digits
+		[[nodiscard]] static bool DecodeLenient(std::string_view const str, UUID& out) noexcept
+		{
+			size_t count{ 0 };
+			for (char const c : str)
+			{
+				if (c == '{' || c == '}' || c == '-' || c == ' ') continue;
+
+				uint8_t const nibble{ HEX_LUT[static_cast<uint8_t>(c)] };
+				if (nibble == 0xFF || count == 32) return false;
+
+				uint8_t& byte{ out.m_Bytes[count >> 1] };
+				byte = (count & 1) ? static_cast<uint8_t>(byte | nibble) : static_cast<uint8_t>(nibble << 4);
+				++count;
+			}
+			return count == 32;
+		}
+		// Swaps Data1, Data2 and Data3 of count 16 byte records, in and out may be the same buffer.
+		// Uses the widest byte shuffle available: picked at runtime with GCC/Clang on x86, at compile time otherwise (-mssse3/-mavx2 or /arch:AVX2).
+		static void ShuffleGuidBytes(uint8_t const* in, uint8_t* out, size_t const count) noexcept
+		{
+			static_assert(sizeof(UUID) == 16 && std::is_trivially_copyable_v<UUID>, "UUID must be 16 plain bytes");
+
+		#if defined(__AVX2__)
+			ShuffleGuidBytesAVX2(in, out, count);
+		#elif defined(MAU_UUID_CPU_DISPATCH)
+			// 2 = AVX2, 1 = SSSE3, 0 = neither, detected once per process
+			static int const level{ []
+			{
+				__builtin_cpu_init();
+				return __builtin_cpu_supports("avx2") ? 2 : __builtin_cpu_supports("ssse3") ? 1 : 0;
+			}() };
+
+			if (level == 2) ShuffleGuidBytesAVX2(in, out, count);
+			else if (level == 1) ShuffleGuidBytesSSSE3(in, out, count);
+			else ShuffleGuidBytesScalar(in, out, count);
+		#elif defined(__SSSE3__)
+			ShuffleGuidBytesSSSE3(in, out, count);
+		#else
+			ShuffleGuidBytesScalar(in, out, count);
+		#endif
+		}
+	#if defined(__AVX2__) || defined(MAU_UUID_CPU_DISPATCH)
+		// One byte shuffle per 2 records
+		MAU_UUID_TARGET("avx2") static void ShuffleGuidBytesAVX2(uint8_t const* in, uint8_t* out, size_t const count) noexcept
+		{
+			__m256i const mask{ _mm256_setr_epi8(
+				3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15,
+				3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15) };
+
+			size_t i{ 0 };
+			for (; i + 2 <= count; i += 2)
+			{
+				__m256i const records{ _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i * 16)) };
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 16), _mm256_shuffle_epi8(records, mask));
+			}
+			ShuffleGuidBytesSSSE3(in + i * 16, out + i * 16, count - i);
+		}
+	#endif
+	#if defined(__AVX2__) || defined(__SSSE3__) || defined(MAU_UUID_CPU_DISPATCH)
+		// One byte shuffle per record
+		MAU_UUID_TARGET("ssse3") static void ShuffleGuidBytesSSSE3(uint8_t const* in, uint8_t* out, size_t const count) noexcept
+		{
+			__m128i const mask{ _mm_setr_epi8(3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15) };
+
+			for (size_t i{ 0 }; i < count; ++i)
+			{
+				__m128i const record{ _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i * 16)) };
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 16), _mm_shuffle_epi8(record, mask));
+			}
+		}
+	#endif
+		static void ShuffleGuidBytesScalar(uint8_t const* in, uint8_t* out, size_t const count) noexcept
+		{
+			for (size_t i{ 0 }; i < count; ++i)
+			{
+				uint8_t record[16];
+				std::memcpy(record, in + i * 16, 16);
+
+				uint8_t* const dst{ out + i * 16 };
+				dst[0] = record[3]; dst[1] = record[2]; dst[2] = record[1]; dst[3] = record[0];
+				dst[4] = record[5]; dst[5] = record[4];
+				dst[6] = record[7]; dst[7] = record[6];
+				std::memcpy(dst + 8, record + 8, 8);
+			}
+		}
+		// Case-insensitive check for the "urn:uuid:" prefix
+		[[nodiscard]] static bool HasUrnPrefix(std::string_view const str) noexcept
+		{
+			static std::string_view constexpr prefix{ "urn:uuid:" };
+			if (str.size() < prefix.size()) return false;
+
+			for (size_t i{ 0 }; i < prefix.size(); ++i)
+			{
+				char c{ str[i] };
+				if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+				if (c != prefix[i]) return false;
+			}
+			return true;
+		}
 	};
 
 	constexpr UUID null_uuid{ std::array<uint8_t, 16>{} };
@@ -406,11 +837,19 @@ namespace MauUUID
 		// read whitespace-delimited token from stream
 		is >> str;
 
-		if (not UUID::TryParse(str, uuid))
+		MAU_UUID_TIME_PARSE(Stream);
+
+		UUID parsed{ null_uuid };
+		if (str.size() != 36 || not UUID::DecodeCanonical(str.data(), parsed))
 		{
+			MAU_UUID_RECORD_PARSE(Stream, false);
 			is.setstate(std::ios::failbit);
+			return is;
 		}
 
+		MAU_UUID_RECORD_PARSE(Stream, true);
+		uuid = parsed;
+
 		return is;
 	}
 
@@ -0,0 +1,401 @@
+#ifndef MAU_UUID_INSTRUMENTATION_H
+#define MAU_UUID_INSTRUMENTATION_H
+
+// Opt-in hot-path instrumentation for MauUUID.
+// Define MAU_UUID_INSTRUMENTATION (or configure with -DMAU_UUID_INSTRUMENTATION=ON) to enable it,
+// when it is not defined every hook below expands to nothing.
+
+#ifdef MAU_UUID_INSTRUMENTATION
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace MauUUID::Instrumentation
+{
+	enum class Backend : uint8_t
+	{
+		Random,
+		Windows,
+		LibUUID,
+		// Bulk generation straight from the OS (getrandom/arc4random_buf), libuuid is not called
+		SystemEntropy,
+
+		COUNT
+	};
+
+	enum class ParseApi : uint8_t
+	{
+		FromString,
+		FromStringLenient,
+		Stream,
+		Any,
+
+		COUNT
+	};
+
+	static size_t constexpr BACKEND_COUNT{ static_cast<size_t>(Backend::COUNT) };
+	static size_t constexpr PARSE_API_COUNT{ static_cast<size_t>(ParseApi::COUNT) };
+	// Bucket i holds samples <= 2^i nanoseconds, the last bucket is open-ended (+Inf)
+	static size_t constexpr HISTOGRAM_BUCKETS{ 32 };
+
+	static constexpr char const* BACKEND_NAMES[BACKEND_COUNT]{ "random", "windows", "libuuid", "system" };
+	static constexpr char const* PARSE_API_NAMES[PARSE_API_COUNT]{ "from_string", "from_string_lenient", "stream", "any" };
+
+	struct Histogram final
+	{
+		std::array<uint64_t, HISTOGRAM_BUCKETS> buckets{};
+		uint64_t count{ 0 };
+		uint64_t sumNs{ 0 };
+
+		Histogram& operator+=(Histogram const& other) noexcept
+		{
+			for (size_t i{ 0 }; i < HISTOGRAM_BUCKETS; ++i)
+			{
+				buckets[i] += other.buckets[i];
+			}
+			count += other.count;
+			sumNs += other.sumNs;
+			return *this;
+		}
+	};
+
+	struct Snapshot final
+	{
+		std::array<uint64_t, BACKEND_COUNT> generated{};
+		// Number of times the OS entropy source was queried (random_device seeding, uuid_generate, CoCreateGuid, one getrandom/arc4random_buf per bulk Generate)
+		uint64_t entropyRequests{ 0 };
+		std::array<uint64_t, PARSE_API_COUNT> parseSuccess{};
+		std::array<uint64_t, PARSE_API_COUNT> parseFailure{};
+
+		Histogram generateLatency{};
+		std::array<Histogram, PARSE_API_COUNT> parseLatency{};
+
+		Snapshot& operator+=(Snapshot const& other) noexcept
+		{
+			for (size_t i{ 0 }; i < BACKEND_COUNT; ++i)
+			{
+				generated[i] += other.generated[i];
+			}
+			entropyRequests += other.entropyRequests;
+			for (size_t i{ 0 }; i < PARSE_API_COUNT; ++i)
+			{
+				parseSuccess[i] += other.parseSuccess[i];
+				parseFailure[i] += other.parseFailure[i];
+				parseLatency[i] += other.parseLatency[i];
+			}
+			generateLatency += other.generateLatency;
+			return *this;
+		}
+	};
+
+	namespace Detail
+	{
+		// Counters are only ever written by their owning thread, so a relaxed load + store is enough (no locked RMW on the hot path).
+		// They are still atomics so a snapshot taken from another thread is not a data race.
+		inline void Bump(std::atomic<uint64_t>& counter, uint64_t const amount = 1) noexcept
+		{
+			counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+		}
+
+		struct AtomicHistogram final
+		{
+			std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS> buckets{};
+			std::atomic<uint64_t> count{ 0 };
+			std::atomic<uint64_t> sumNs{ 0 };
+
+			void Record(uint64_t const ns) noexcept
+			{
+				size_t const bucket{ ns <= 1 ? 0 : static_cast<size_t>(std::bit_width(ns - 1)) };
+				Bump(buckets[bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1]);
+				Bump(count);
+				Bump(sumNs, ns);
+			}
+
+			void CollectInto(Histogram& out) const noexcept
+			{
+				for (size_t i{ 0 }; i < HISTOGRAM_BUCKETS; ++i)
+				{
+					out.buckets[i] += buckets[i].load(std::memory_order_relaxed);
+				}
+				out.count += count.load(std::memory_order_relaxed);
+				out.sumNs += sumNs.load(std::memory_order_relaxed);
+			}
+		};
+
+		struct ThreadCounters;
+
+		struct Registry final
+		{
+			std::mutex mutex;
+			std::vector<ThreadCounters const*> live;
+			// Totals of threads that already exited
+			Snapshot retired;
+		};
+
+		// Never destroyed: threads owned by other statics (e.g. parallel::DefaultPool()) can exit after static destruction started and still retire their counters
+		inline Registry& GetRegistry() noexcept
+		{
+			static Registry* const registry{ new Registry{} };
+			return *registry;
+		}
+
+		inline std::atomic<uint32_t>& SampleInterval() noexcept
+		{
+			static std::atomic<uint32_t> interval{ 0 };
+			return interval;
+		}
+
+		struct ThreadCounters final
+		{
+			std::array<std::atomic<uint64_t>, BACKEND_COUNT> generated{};
+			std::atomic<uint64_t> entropyRequests{ 0 };
+			std::array<std::atomic<uint64_t>, PARSE_API_COUNT> parseSuccess{};
+			std::array<std::atomic<uint64_t>, PARSE_API_COUNT> parseFailure{};
+
+			AtomicHistogram generateLatency{};
+			std::array<AtomicHistogram, PARSE_API_COUNT> parseLatency{};
+
+			uint32_t sampleCountdown{ 0 };
+
+			ThreadCounters()
+			{
+				auto& registry{ GetRegistry() };
+				std::scoped_lock const lock{ registry.mutex };
+				registry.live.push_back(this);
+			}
+			~ThreadCounters()
+			{
+				auto& registry{ GetRegistry() };
+				std::scoped_lock const lock{ registry.mutex };
+				CollectInto(registry.retired);
+				std::erase(registry.live, this);
+			}
+
+			ThreadCounters(ThreadCounters const&) = delete;
+			ThreadCounters(ThreadCounters&&) = delete;
+			ThreadCounters& operator=(ThreadCounters const&) = delete;
+			ThreadCounters& operator=(ThreadCounters&&) = delete;
+
+			void CollectInto(Snapshot& out) const noexcept
+			{
+				for (size_t i{ 0 }; i < BACKEND_COUNT; ++i)
+				{
+					out.generated[i] += generated[i].load(std::memory_order_relaxed);
+				}
+				out.entropyRequests += entropyRequests.load(std::memory_order_relaxed);
+				for (size_t i{ 0 }; i < PARSE_API_COUNT; ++i)
+				{
+					out.parseSuccess[i] += parseSuccess[i].load(std::memory_order_relaxed);
+					out.parseFailure[i] += parseFailure[i].load(std::memory_order_relaxed);
+					parseLatency[i].CollectInto(out.parseLatency[i]);
+				}
+				generateLatency.CollectInto(out.generateLatency);
+			}
+
+			[[nodiscard]] bool ShouldSample() noexcept
+			{
+				uint32_t const interval{ SampleInterval().load(std::memory_order_relaxed) };
+				if (interval == 0)
+				{
+					return false;
+				}
+				if (sampleCountdown == 0 || sampleCountdown > interval)
+				{
+					sampleCountdown = interval;
+				}
+				return --sampleCountdown == 0;
+			}
+		};
+
+		inline ThreadCounters& Local() noexcept
+		{
+			thread_local ThreadCounters counters;
+			return counters;
+		}
+
+		inline void RecordGenerate(Backend const backend, uint64_t const count) noexcept
+		{
+			Bump(Local().generated[static_cast<size_t>(backend)], count);
+		}
+		inline void RecordEntropyRequests(uint64_t const count) noexcept
+		{
+			Bump(Local().entropyRequests, count);
+		}
+		inline void RecordParse(ParseApi const api, bool const success) noexcept
+		{
+			auto& counters{ Local() };
+			Bump(success ? counters.parseSuccess[static_cast<size_t>(api)] : counters.parseFailure[static_cast<size_t>(api)]);
+		}
+
+		class ScopedLatency final
+		{
+		public:
+			explicit ScopedLatency(AtomicHistogram& histogram, bool const sample) noexcept
+				: m_pHistogram{ sample ? &histogram : nullptr }
+			{
+				if (m_pHistogram)
+				{
+					m_Start = std::chrono::steady_clock::now();
+				}
+			}
+			~ScopedLatency()
+			{
+				if (m_pHistogram)
+				{
+					auto const elapsed{ std::chrono::steady_clock::now() - m_Start };
+					m_pHistogram->Record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+				}
+			}
+
+			ScopedLatency(ScopedLatency const&) = delete;
+			ScopedLatency(ScopedLatency&&) = delete;
+			ScopedLatency& operator=(ScopedLatency const&) = delete;
+			ScopedLatency& operator=(ScopedLatency&&) = delete;
+
+		private:
+			AtomicHistogram* m_pHistogram;
+			std::chrono::steady_clock::time_point m_Start{};
+		};
+
+		inline AtomicHistogram& GenerateHistogram() noexcept { return Local().generateLatency; }
+		inline AtomicHistogram& ParseHistogram(ParseApi const api) noexcept { return Local().parseLatency[static_cast<size_t>(api)]; }
+		inline bool ShouldSample() noexcept { return Local().ShouldSample(); }
+
+		inline void AppendCounter(std::string& out, char const* name, std::string const& labels, uint64_t const value)
+		{
+			out += name;
+			if (!labels.empty())
+			{
+				out += '{';
+				out += labels;
+				out += '}';
+			}
+			out += ' ';
+			out += std::to_string(value);
+			out += '\n';
+		}
+
+		inline void AppendHistogram(std::string& out, char const* name, std::string const& labels, Histogram const& histogram)
+		{
+			std::string const prefix{ labels.empty() ? std::string{} : labels + ',' };
+			std::string const bucketName{ std::string{ name } + "_bucket" };
+
+			uint64_t cumulative{ 0 };
+			for (size_t i{ 0 }; i < HISTOGRAM_BUCKETS; ++i)
+			{
+				cumulative += histogram.buckets[i];
+				std::string const le{ i + 1 == HISTOGRAM_BUCKETS ? std::string{ "+Inf" } : std::to_string(uint64_t{ 1 } << i) };
+				AppendCounter(out, bucketName.c_str(), prefix + "le=\"" + le + '"', cumulative);
+			}
+			AppendCounter(out, (std::string{ name } + "_sum").c_str(), labels, histogram.sumNs);
+			AppendCounter(out, (std::string{ name } + "_count").c_str(), labels, histogram.count);
+		}
+	}
+
+	/**
+	 * @brief Set how often latency is sampled, per thread.
+	 * @param interval Sample one out of every interval operations, 0 disables latency sampling (default).
+	 */
+	inline void SetLatencySampleInterval(uint32_t const interval) noexcept
+	{
+		Detail::SampleInterval().store(interval, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Get the counters of the calling thread only.
+	 * @return Snapshot of the calling thread's counters.
+	 */
+	[[nodiscard]] inline Snapshot GetThreadSnapshot() noexcept
+	{
+		Snapshot snapshot{};
+		Detail::Local().CollectInto(snapshot);
+		return snapshot;
+	}
+
+	/**
+	 * @brief Aggregate the counters of all live threads and of all threads that already exited.
+	 * @return Process wide snapshot.
+	 */
+	[[nodiscard]] inline Snapshot GetSnapshot()
+	{
+		auto& registry{ Detail::GetRegistry() };
+		std::scoped_lock const lock{ registry.mutex };
+
+		Snapshot snapshot{ registry.retired };
+		for (auto const* counters : registry.live)
+		{
+			counters->CollectInto(snapshot);
+		}
+		return snapshot;
+	}
+
+	/**
+	 * @brief Export a snapshot in the Prometheus text exposition format.
+	 * @param snapshot Snapshot to export, usually the result of GetSnapshot().
+	 * @return Prometheus text, latencies are in nanoseconds.
+	 */
+	[[nodiscard]] inline std::string ToPrometheus(Snapshot const& snapshot)
+	{
+		std::string out;
+		out.reserve(8192);
+
+		out += "# HELP mau_uuid_generated_total UUIDs generated, by backend.\n";
+		out += "# TYPE mau_uuid_generated_total counter\n";
+		for (size_t i{ 0 }; i < BACKEND_COUNT; ++i)
+		{
+			Detail::AppendCounter(out, "mau_uuid_generated_total", std::string{ "backend=\"" } + BACKEND_NAMES[i] + '"', snapshot.generated[i]);
+		}
+
+		out += "# HELP mau_uuid_entropy_requests_total Requests made to the OS entropy source.\n";
+		out += "# TYPE mau_uuid_entropy_requests_total counter\n";
+		Detail::AppendCounter(out, "mau_uuid_entropy_requests_total", {}, snapshot.entropyRequests);
+
+		out += "# HELP mau_uuid_parse_total Parse attempts, by API and result.\n";
+		out += "# TYPE mau_uuid_parse_total counter\n";
+		for (size_t i{ 0 }; i < PARSE_API_COUNT; ++i)
+		{
+			std::string const api{ std::string{ "api=\"" } + PARSE_API_NAMES[i] + '"' };
+			Detail::AppendCounter(out, "mau_uuid_parse_total", api + ",result=\"success\"", snapshot.parseSuccess[i]);
+			Detail::AppendCounter(out, "mau_uuid_parse_total", api + ",result=\"failure\"", snapshot.parseFailure[i]);
+		}
+
+		out += "# HELP mau_uuid_generate_latency_nanoseconds Sampled UUID generation latency.\n";
+		out += "# TYPE mau_uuid_generate_latency_nanoseconds histogram\n";
+		Detail::AppendHistogram(out, "mau_uuid_generate_latency_nanoseconds", {}, snapshot.generateLatency);
+
+		out += "# HELP mau_uuid_parse_latency_nanoseconds Sampled UUID parse latency, by API.\n";
+		out += "# TYPE mau_uuid_parse_latency_nanoseconds histogram\n";
+		for (size_t i{ 0 }; i < PARSE_API_COUNT; ++i)
+		{
+			Detail::AppendHistogram(out, "mau_uuid_parse_latency_nanoseconds", std::string{ "api=\"" } + PARSE_API_NAMES[i] + '"', snapshot.parseLatency[i]);
+		}
+
+		return out;
+	}
+}
+
+#define MAU_UUID_RECORD_GENERATE(backend, count) ::MauUUID::Instrumentation::Detail::RecordGenerate(::MauUUID::Instrumentation::Backend::backend, count)
+#define MAU_UUID_RECORD_ENTROPY_REQUESTS(count) ::MauUUID::Instrumentation::Detail::RecordEntropyRequests(count)
+#define MAU_UUID_RECORD_PARSE(api, success) ::MauUUID::Instrumentation::Detail::RecordParse(::MauUUID::Instrumentation::ParseApi::api, success)
+#define MAU_UUID_TIME_GENERATE() \
+	::MauUUID::Instrumentation::Detail::ScopedLatency const mauUUIDScopedLatency{ ::MauUUID::Instrumentation::Detail::GenerateHistogram(), ::MauUUID::Instrumentation::Detail::ShouldSample() }
+#define MAU_UUID_TIME_PARSE(api) \
+	::MauUUID::Instrumentation::Detail::ScopedLatency const mauUUIDScopedLatency{ ::MauUUID::Instrumentation::Detail::ParseHistogram(::MauUUID::Instrumentation::ParseApi::api), ::MauUUID::Instrumentation::Detail::ShouldSample() }
+
+#else
+
+#define MAU_UUID_RECORD_GENERATE(backend, count) ((void)0)
+#define MAU_UUID_RECORD_ENTROPY_REQUESTS(count) ((void)0)
+#define MAU_UUID_RECORD_PARSE(api, success) ((void)0)
+#define MAU_UUID_TIME_GENERATE() ((void)0)
+#define MAU_UUID_TIME_PARSE(api) ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,306 @@
+#ifndef MAU_UUID_INTERNER_H
+#define MAU_UUID_INTERNER_H
+
+#include "uuid.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace MauUUID
+{
+	/**
+	 * @brief Maps every distinct UUID to a dense 32 bit handle (0, 1, 2, ... in insertion order).
+	 * Handle -> UUID is an index into a contiguous array, UUID -> handle is an open addressing table of 8 byte slots.
+	 * All member functions are thread-safe. After Freeze() no more UUIDs can be added and lookups no longer take a lock.
+	 */
+	class UUIDInterner final
+	{
+	public:
+		static uint32_t constexpr INVALID_HANDLE{ std::numeric_limits<uint32_t>::max() };
+
+		/**
+		 * @brief Create an interner.
+		 * @param expectedCount Number of distinct UUIDs to reserve space for.
+		 */
+		explicit UUIDInterner(size_t const expectedCount = 0)
+		{
+			m_UUIDs.reserve(expectedCount);
+			m_Slots.assign(CapacityFor(expectedCount), Slot{});
+		}
+
+		~UUIDInterner() = default;
+		UUIDInterner(UUIDInterner const&) = delete;
+		UUIDInterner(UUIDInterner&&) = delete;
+		UUIDInterner& operator=(UUIDInterner const&) = delete;
+		UUIDInterner& operator=(UUIDInterner&&) = delete;
+
+		/**
+		 * @brief Get the handle of a UUID, adding it if it was not interned yet.
+		 * @param uuid UUID to intern.
+		 * @warning Asserts if the interner is frozen, returns INVALID_HANDLE for new UUIDs in that case.
+		 * @return Handle of the UUID.
+		 */
+		[[nodiscard]] uint32_t Intern(UUID const& uuid)
+		{
+			uint32_t handle{ INVALID_HANDLE };
+			InternMany(std::span{ &uuid, 1 }, std::span{ &handle, 1 });
+			return handle;
+		}
+		/**
+		 * @brief Intern a batch of UUIDs, out[i] receives the handle of in[i].
+		 * Existing UUIDs are resolved under a shared lock, the exclusive lock is only taken once for all new ones.
+		 * @param in UUIDs to intern.
+		 * @param out Output, must be at least as large as in.
+		 * @warning Asserts if the interner is frozen, new UUIDs get INVALID_HANDLE in that case.
+		 */
+		void InternMany(std::span<UUID const> const in, std::span<uint32_t> const out)
+		{
+			assert(out.size() >= in.size() && "Output span too small!");
+
+			if (m_Frozen.load(std::memory_order_acquire))
+			{
+				for (size_t i{ 0 }; i < in.size(); ++i)
+				{
+					out[i] = FindUnlocked(in[i]);
+					assert(out[i] != INVALID_HANDLE && "Cannot intern new UUIDs after Freeze!");
+				}
+				return;
+			}
+
+			bool missing{ false };
+			{
+				std::shared_lock const lock{ m_Mutex };
+				for (size_t i{ 0 }; i < in.size(); ++i)
+				{
+					out[i] = FindUnlocked(in[i]);
+					missing |= out[i] == INVALID_HANDLE;
+				}
+			}
+			if (!missing)
+			{
+				return;
+			}
+
+			std::unique_lock const lock{ m_Mutex };
+			// Frozen or added by another thread while the lock was released, InsertUnlocked checks again
+			bool const frozen{ m_Frozen.load(std::memory_order_relaxed) };
+			for (size_t i{ 0 }; i < in.size(); ++i)
+			{
+				if (out[i] == INVALID_HANDLE)
+				{
+					out[i] = frozen ? FindUnlocked(in[i]) : InsertUnlocked(in[i]);
+					assert(out[i] != INVALID_HANDLE && "Cannot intern new UUIDs after Freeze!");
+				}
+			}
+		}
+		/**
+		 * @brief Get the handle of a UUID without adding it.
+		 * @param uuid UUID to look up.
+		 * @return The handle, or std::nullopt if the UUID was not interned.
+		 */
+		[[nodiscard]] std::optional<uint32_t> Find(UUID const& uuid) const
+		{
+			uint32_t handle;
+			if (m_Frozen.load(std::memory_order_acquire))
+			{
+				handle = FindUnlocked(uuid);
+			}
+			else
+			{
+				std::shared_lock const lock{ m_Mutex };
+				handle = FindUnlocked(uuid);
+			}
+
+			if (handle == INVALID_HANDLE)
+			{
+				return std::nullopt;
+			}
+			return handle;
+		}
+		/**
+		 * @brief Get the UUID of a handle.
+		 * @param handle Handle returned by Intern, must be valid (asserts in Debug).
+		 * @return The UUID.
+		 */
+		[[nodiscard]] UUID Get(uint32_t const handle) const
+		{
+			if (m_Frozen.load(std::memory_order_acquire))
+			{
+				assert(handle < m_UUIDs.size() && "Invalid handle!");
+				return m_UUIDs[handle];
+			}
+
+			std::shared_lock const lock{ m_Mutex };
+			assert(handle < m_UUIDs.size() && "Invalid handle!");
+			return m_UUIDs[handle];
+		}
+		/**
+		 * @brief Get all interned UUIDs, indexed by handle.
+		 * @warning Only available once frozen (asserts in Debug), before that the array can be reallocated at any time.
+		 * @return Span over the contiguous UUID array.
+		 */
+		[[nodiscard]] std::span<UUID const> UUIDs() const noexcept
+		{
+			assert(IsFrozen() && "UUIDs() requires a frozen interner!");
+			return m_UUIDs;
+		}
+		/**
+		 * @brief Get the number of distinct UUIDs interned.
+		 */
+		[[nodiscard]] size_t Size() const
+		{
+			if (m_Frozen.load(std::memory_order_acquire))
+			{
+				return m_UUIDs.size();
+			}
+
+			std::shared_lock const lock{ m_Mutex };
+			return m_UUIDs.size();
+		}
+		/**
+		 * @brief Get the heap memory used by the interner in bytes.
+		 */
+		[[nodiscard]] size_t MemoryUsage() const
+		{
+			std::shared_lock const lock{ m_Mutex };
+			return m_UUIDs.capacity() * sizeof(UUID) + m_Slots.capacity() * sizeof(Slot);
+		}
+
+		/**
+		 * @brief Make the interner read-only, afterwards Find, Get, Size and UUIDs do not take a lock.
+		 */
+		void Freeze()
+		{
+			std::unique_lock const lock{ m_Mutex };
+			if (m_Frozen.load(std::memory_order_relaxed))
+			{
+				return;
+			}
+
+			m_UUIDs.shrink_to_fit();
+			m_Frozen.store(true, std::memory_order_release);
+		}
+		/**
+		 * @brief Check if the interner is frozen.
+		 */
+		[[nodiscard]] bool IsFrozen() const noexcept { return m_Frozen.load(std::memory_order_acquire); }
+
+	private:
+		// tag holds the low 32 bits of the hash so most mismatches are rejected without touching m_UUIDs
+		struct Slot final
+		{
+			uint32_t tag{ 0 };
+			uint32_t handle{ INVALID_HANDLE };
+		};
+
+		static size_t constexpr MIN_CAPACITY{ 16 };
+
+		std::vector<UUID> m_UUIDs;
+		// Open addressing with linear probing, power of 2 capacity, at most 3/4 full
+		std::vector<Slot> m_Slots;
+
+		mutable std::shared_mutex m_Mutex;
+		std::atomic<bool> m_Frozen{ false };
+
+		[[nodiscard]] static size_t CapacityFor(size_t const count) noexcept
+		{
+			size_t capacity{ MIN_CAPACITY };
+			while (capacity * 3 / 4 < count)
+			{
+				capacity *= 2;
+			}
+			return capacity;
+		}
+
+		// Mixes both halves so sequential or time-ordered UUIDs spread as well as random ones
+		[[nodiscard]] static uint64_t HashOf(UUID const& uuid) noexcept
+		{
+			auto const data{ uuid.Data64() };
+
+			uint64_t hash{ data[0] ^ (data[1] * 0x9E3779B97F4A7C15ull) };
+			hash ^= hash >> 31;
+			hash *= 0xBF58476D1CE4E5B9ull;
+			hash ^= hash >> 29;
+			return hash;
+		}
+
+		[[nodiscard]] uint32_t FindUnlocked(UUID const& uuid) const noexcept
+		{
+			uint64_t const hash{ HashOf(uuid) };
+			uint32_t const tag{ static_cast<uint32_t>(hash) };
+			size_t const mask{ m_Slots.size() - 1 };
+
+			for (size_t index{ static_cast<size_t>(hash >> 32) & mask }; ; index = (index + 1) & mask)
+			{
+				Slot const& slot{ m_Slots[index] };
+				if (slot.handle == INVALID_HANDLE)
+				{
+					return INVALID_HANDLE;
+				}
+				if (slot.tag == tag && m_UUIDs[slot.handle] == uuid)
+				{
+					return slot.handle;
+				}
+			}
+		}
+
+		[[nodiscard]] uint32_t InsertUnlocked(UUID const& uuid)
+		{
+			uint64_t const hash{ HashOf(uuid) };
+			uint32_t const tag{ static_cast<uint32_t>(hash) };
+			size_t const mask{ m_Slots.size() - 1 };
+
+			size_t index{ static_cast<size_t>(hash >> 32) & mask };
+			for (; m_Slots[index].handle != INVALID_HANDLE; index = (index + 1) & mask)
+			{
+				if (m_Slots[index].tag == tag && m_UUIDs[m_Slots[index].handle] == uuid)
+				{
+					return m_Slots[index].handle;
+				}
+			}
+
+			assert(m_UUIDs.size() < INVALID_HANDLE && "Out of handles!");
+			uint32_t const handle{ static_cast<uint32_t>(m_UUIDs.size()) };
+			m_UUIDs.push_back(uuid);
+			m_Slots[index] = Slot{ tag, handle };
+
+			if (m_UUIDs.size() > m_Slots.size() * 3 / 4)
+			{
+				Rehash(m_Slots.size() * 2);
+			}
+			return handle;
+		}
+
+		void Rehash(size_t const capacity)
+		{
+			std::vector<Slot> slots(capacity);
+			size_t const mask{ capacity - 1 };
+
+			for (auto const& slot : m_Slots)
+			{
+				if (slot.handle == INVALID_HANDLE)
+				{
+					continue;
+				}
+
+				size_t index{ static_cast<size_t>(HashOf(m_UUIDs[slot.handle]) >> 32) & mask };
+				while (slots[index].handle != INVALID_HANDLE)
+				{
+					index = (index + 1) & mask;
+				}
+				slots[index] = slot;
+			}
+
+			m_Slots = std::move(slots);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,311 @@
+#ifndef MAU_UUID_PARALLEL_H
+#define MAU_UUID_PARALLEL_H
+
+#include "uuid.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace MauUUID::parallel
+{
+	/**
+	 * @brief Anything that can run task(0) ... task(taskCount - 1), in any order and on any thread, and block until all of them finished.
+	 */
+	template <typename E>
+	concept Executor = requires(E& executor, size_t taskCount, std::function<void(size_t)> const& task)
+	{
+		executor.Run(taskCount, task);
+	};
+
+	/**
+	 * @brief Executor running every task on the calling thread.
+	 */
+	struct SerialExecutor final
+	{
+		void Run(size_t const taskCount, std::function<void(size_t)> const& task) const
+		{
+			for (size_t i{ 0 }; i < taskCount; ++i)
+			{
+				task(i);
+			}
+		}
+	};
+
+	/**
+	 * @brief Fixed size thread pool, the calling thread takes part in every Run.
+	 * Idle threads claim the next task from a shared counter, so a thread that finishes early keeps taking work from the slower ones.
+	 * A Run issued from inside a task runs inline on that thread.
+	 */
+	class ThreadPool final
+	{
+	public:
+		/**
+		 * @brief Create a thread pool.
+		 * @param threadCount Number of threads taking part in a Run, including the calling thread.
+		 */
+		explicit ThreadPool(size_t const threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1))
+		{
+			size_t const workerCount{ threadCount > 1 ? threadCount - 1 : 0 };
+			m_Workers.reserve(workerCount);
+			for (size_t i{ 0 }; i < workerCount; ++i)
+			{
+				m_Workers.emplace_back([this] { WorkerLoop(); });
+			}
+		}
+		~ThreadPool()
+		{
+			{
+				std::scoped_lock const lock{ m_Mutex };
+				m_Stop = true;
+			}
+			m_WakeCondition.notify_all();
+
+			for (auto& worker : m_Workers)
+			{
+				worker.join();
+			}
+		}
+
+		ThreadPool(ThreadPool const&) = delete;
+		ThreadPool(ThreadPool&&) = delete;
+		ThreadPool& operator=(ThreadPool const&) = delete;
+		ThreadPool& operator=(ThreadPool&&) = delete;
+
+		/**
+		 * @brief Get the number of threads taking part in a Run, including the calling thread.
+		 */
+		[[nodiscard]] size_t ThreadCount() const noexcept { return m_Workers.size() + 1; }
+
+		/**
+		 * @brief Run task(0) ... task(taskCount - 1) across the pool and wait for all of them.
+		 * @param taskCount Number of tasks.
+		 * @param task Task to run, must not throw.
+		 */
+		void Run(size_t const taskCount, std::function<void(size_t)> const& task)
+		{
+			if (taskCount == 0)
+			{
+				return;
+			}
+			if (taskCount == 1 || m_Workers.empty() || InsideTask())
+			{
+				SerialExecutor{}.Run(taskCount, task);
+				return;
+			}
+
+			// One Run at a time, concurrent callers queue up here
+			std::scoped_lock const runLock{ m_RunMutex };
+
+			Job job{ &task, taskCount };
+			{
+				std::scoped_lock const lock{ m_Mutex };
+				m_pJob = &job;
+				++m_Generation;
+			}
+			m_WakeCondition.notify_all();
+
+			InsideTask() = true;
+			Drain(job);
+			InsideTask() = false;
+
+			// Every claimed task is owned by a worker that is still registered on the job
+			std::unique_lock lock{ m_Mutex };
+			m_DoneCondition.wait(lock, [&job] { return job.workers == 0; });
+			m_pJob = nullptr;
+		}
+
+	private:
+		struct Job final
+		{
+			std::function<void(size_t)> const* pTask;
+			size_t taskCount;
+			std::atomic<size_t> nextTask{ 0 };
+			// Workers currently draining this job, guarded by m_Mutex
+			size_t workers{ 0 };
+		};
+
+		std::vector<std::thread> m_Workers;
+
+		std::mutex m_RunMutex;
+		std::mutex m_Mutex;
+		std::condition_variable m_WakeCondition;
+		std::condition_variable m_DoneCondition;
+
+		Job* m_pJob{ nullptr };
+		uint64_t m_Generation{ 0 };
+		bool m_Stop{ false };
+
+		// True on worker threads and on a caller while it drains, nested Runs then run inline instead of deadlocking
+		[[nodiscard]] static bool& InsideTask() noexcept
+		{
+			static thread_local bool insideTask{ false };
+			return insideTask;
+		}
+
+		static void Drain(Job& job)
+		{
+			for (size_t i{ job.nextTask.fetch_add(1, std::memory_order_relaxed) }; i < job.taskCount; i = job.nextTask.fetch_add(1, std::memory_order_relaxed))
+			{
+				(*job.pTask)(i);
+			}
+		}
+
+		void WorkerLoop()
+		{
+			InsideTask() = true;
+
+			uint64_t seenGeneration{ 0 };
+			std::unique_lock lock{ m_Mutex };
+			while (true)
+			{
+				m_WakeCondition.wait(lock, [&] { return m_Stop || m_Generation != seenGeneration; });
+				if (m_Stop)
+				{
+					return;
+				}
+
+				seenGeneration = m_Generation;
+				Job* const pJob{ m_pJob };
+				if (!pJob)
+				{
+					continue;
+				}
+
+				++pJob->workers;
+				lock.unlock();
+
+				Drain(*pJob);
+
+				lock.lock();
+				if (--pJob->workers == 0)
+				{
+					m_DoneCondition.notify_all();
+				}
+			}
+		}
+	};
+
+	/**
+	 * @brief Get the process wide pool used when no executor is passed, sized to the hardware concurrency.
+	 */
+	[[nodiscard]] inline ThreadPool& DefaultPool()
+	{
+		static ThreadPool pool{};
+		return pool;
+	}
+
+	// Elements per task, 2048 UUIDs are 32 KiB so a chunk's input and output stay in L1/L2 while it is processed
+	static size_t constexpr CHUNK_SIZE{ 2048 };
+
+	namespace Detail
+	{
+		template <Executor E, typename F>
+		void ForEachChunk(E& executor, size_t const count, F&& body)
+		{
+			size_t const chunkCount{ (count + CHUNK_SIZE - 1) / CHUNK_SIZE };
+			if (chunkCount <= 1)
+			{
+				body(size_t{ 0 }, count);
+				return;
+			}
+
+			executor.Run(chunkCount, [&body, count](size_t const chunk)
+			{
+				size_t const begin{ chunk * CHUNK_SIZE };
+				body(begin, std::min(begin + CHUNK_SIZE, count));
+			});
+		}
+	}
+
+	/**
+	 * @brief Generate a new UUID into every element of out.
+	 * Each chunk goes through UUID::Generate on its own thread: one getrandom/arc4random_buf request per chunk with libuuid,
+	 * the thread local engine for the portable backend, one CoCreateGuid call per UUID on Windows.
+	 * @param out UUIDs to overwrite with newly generated ones.
+	 * @param executor Executor to run on, defaults to DefaultPool().
+	 */
+	template <Executor E = ThreadPool>
+	void Generate(std::span<UUID> const out, E& executor = DefaultPool())
+	{
+		Detail::ForEachChunk(executor, out.size(), [out](size_t const begin, size_t const end)
+		{
+			UUID::Generate(out.subspan(begin, end - begin));
+		});
+	}
+
+	/**
+	 * @brief Format every UUID, out[i] receives the null-terminated string of in[i] (see UUID::CStr).
+	 * @param in UUIDs to format.
+	 * @param out Output buffers, must be at least as large as in.
+	 * @param executor Executor to run on, defaults to DefaultPool().
+	 */
+	template <Executor E = ThreadPool>
+	void Format(std::span<UUID const> const in, std::span<std::array<char, 37>> const out, E& executor = DefaultPool())
+	{
+		assert(out.size() >= in.size() && "Output span too small!");
+
+		Detail::ForEachChunk(executor, in.size(), [in, out](size_t const begin, size_t const end)
+		{
+			for (size_t i{ begin }; i < end; ++i)
+			{
+				in[i].CStr(out[i]);
+			}
+		});
+	}
+
+	/**
+	 * @brief Parse every string with UUID::ParseAny, out[i] receives the result for in[i].
+	 * @param in Strings to parse.
+	 * @param out Output, must be at least as large as in.
+	 * @param executor Executor to run on, defaults to DefaultPool().
+	 * @return Number of strings that were parsed successfully.
+	 */
+	template <Executor E = ThreadPool>
+	size_t Parse(std::span<std::string_view const> const in, std::span<std::optional<UUID>> const out, E& executor = DefaultPool())
+	{
+		assert(out.size() >= in.size() && "Output span too small!");
+
+		std::atomic<size_t> parsed{ 0 };
+		Detail::ForEachChunk(executor, in.size(), [in, out, &parsed](size_t const begin, size_t const end)
+		{
+			size_t const count{ end - begin };
+			parsed.fetch_add(UUID::ParseAny(in.subspan(begin, count), out.subspan(begin, count)), std::memory_order_relaxed);
+		});
+		return parsed.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Hash every UUID, out[i] receives the hash of in[i].
+	 * @tparam Hasher Hash function, defaults to std::hash<UUID>.
+	 * @param in UUIDs to hash.
+	 * @param out Output, must be at least as large as in.
+	 * @param executor Executor to run on, defaults to DefaultPool().
+	 */
+	template <typename Hasher = std::hash<UUID>, Executor E = ThreadPool>
+	void Hash(std::span<UUID const> const in, std::span<size_t> const out, E& executor = DefaultPool())
+	{
+		assert(out.size() >= in.size() && "Output span too small!");
+
+		Detail::ForEachChunk(executor, in.size(), [in, out](size_t const begin, size_t const end)
+		{
+			Hasher const hasher{};
+			for (size_t i{ begin }; i < end; ++i)
+			{
+				out[i] = hasher(in[i]);
+			}
+		});
+	}
+}
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef MAU_UUID_VIEWS_H
+#define MAU_UUID_VIEWS_H
+
+#include "uuid.h"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <utility>
+
+namespace MauUUID
+{
+	/**
+	 * @brief Generator that fills a whole span at once, e.g. through UUID::Generate.
+	 */
+	template <typename G>
+	concept BulkUUIDGenerator = requires(G& generator, std::span<UUID> out)
+	{
+		generator.Generate(out);
+	};
+
+	/**
+	 * @brief Anything that can produce UUIDs: a bulk generator or a callable returning a UUID.
+	 */
+	template <typename G>
+	concept UUIDGenerator = BulkUUIDGenerator<G> || requires(G& generator)
+	{
+		{ generator() } -> std::convertible_to<UUID>;
+	};
+
+	/**
+	 * @brief Default generator, uses the platform backend (random version 4 UUIDs).
+	 */
+	struct DefaultGenerator final
+	{
+		void Generate(std::span<UUID> const out) const noexcept { UUID::Generate(out); }
+		[[nodiscard]] UUID operator()() const noexcept { return UUID{}; }
+	};
+
+	/**
+	 * @brief Unbounded input range of newly generated UUIDs.
+	 * UUIDs are generated ChunkSize at a time into a buffer owned by the view, so memory stays constant however many are consumed.
+	 * The view is move-only, a copy would hand out the same buffered UUIDs twice.
+	 */
+	template <UUIDGenerator G, size_t ChunkSize = 64>
+	class GenerateView final : public std::ranges::view_interface<GenerateView<G, ChunkSize>>
+	{
+		static_assert(ChunkSize > 0, "ChunkSize must be at least 1");
+
+	public:
+		class Iterator final
+		{
+		public:
+			using iterator_concept = std::input_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = UUID;
+
+			Iterator() noexcept = default;
+			explicit Iterator(GenerateView* pView) noexcept : m_pView{ pView } { }
+
+			// Refills lazily, so taking a multiple of ChunkSize UUIDs does not generate an extra chunk that is never read
+			[[nodiscard]] UUID const& operator*() const
+			{
+				if (m_pView->m_Position == ChunkSize)
+				{
+					m_pView->Refill();
+				}
+				return m_pView->m_Chunk[m_pView->m_Position];
+			}
+
+			Iterator& operator++()
+			{
+				// Skipping past a chunk that was never read still has to consume it
+				if (m_pView->m_Position == ChunkSize)
+				{
+					m_pView->Refill();
+				}
+				++m_pView->m_Position;
+				return *this;
+			}
+			void operator++(int) { ++*this; }
+
+		private:
+			GenerateView* m_pView{ nullptr };
+		};
+
+		explicit GenerateView(G generator) noexcept(std::is_nothrow_move_constructible_v<G>)
+			: m_Generator{ std::move(generator) }
+		{
+		}
+
+		~GenerateView() = default;
+		GenerateView(GenerateView const&) = delete;
+		GenerateView(GenerateView&&) = default;
+		GenerateView& operator=(GenerateView const&) = delete;
+		GenerateView& operator=(GenerateView&&) = default;
+
+		[[nodiscard]] Iterator begin() noexcept { return Iterator{ this }; }
+		[[nodiscard]] std::unreachable_sentinel_t end() const noexcept { return {}; }
+
+	private:
+		G m_Generator;
+		// Filled with null UUIDs, default constructing would generate ChunkSize UUIDs up front
+		std::array<UUID, ChunkSize> m_Chunk{ []<size_t... I>(std::index_sequence<I...>)
+		{
+			return std::array<UUID, ChunkSize>{ ((void)I, null_uuid)... };
+		}(std::make_index_sequence<ChunkSize>{}) };
+		size_t m_Position{ ChunkSize };
+
+		void Refill()
+		{
+			if constexpr (BulkUUIDGenerator<G>)
+			{
+				m_Generator.Generate(std::span<UUID>{ m_Chunk });
+			}
+			else
+			{
+				for (auto& uuid : m_Chunk)
+				{
+					uuid = m_Generator();
+				}
+			}
+			m_Position = 0;
+		}
+	};
+
+	namespace views
+	{
+		/**
+		 * @brief Lazily generate UUIDs, composes with std::views::take, std::views::transform, ...
+		 * @param generator Generator to use, defaults to the platform backend.
+		 * @return Unbounded input range of new UUIDs.
+		 */
+		template <size_t ChunkSize = 64, UUIDGenerator G = DefaultGenerator>
+		[[nodiscard]] GenerateView<G, ChunkSize> generate(G generator = {})
+		{
+			return GenerateView<G, ChunkSize>{ std::move(generator) };
+		}
+	}
+}
+
+#endif
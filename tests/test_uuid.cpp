@@ -252,3 +252,257 @@ TEST_CASE("UUID FromStringLenient", "[uuid][construction]")
     REQUIRE(uuid_base == MauUUID::UUID::FromStringLenient(uuid_str_upper));
     REQUIRE(uuid_base == MauUUID::UUID::FromStringLenient(uuid_str_spaces));
 }
+
+TEST_CASE("UUID TryParseLenient rejects malformed strings", "[uuid][parse][lenient]")
+{
+    MauUUID::UUID uuid{ MauUUID::null_uuid };
+
+    REQUIRE(MauUUID::UUID::TryParseLenient("{123e4567 e89b 12d3 a456 426614174000}", uuid));
+    REQUIRE(uuid.Str() == "123e4567-e89b-12d3-a456-426614174000");
+
+    MauUUID::UUID const before{ uuid };
+    REQUIRE_FALSE(MauUUID::UUID::TryParseLenient("123e4567e89b12d3a45642661417400", uuid)); // 31 digits
+    REQUIRE_FALSE(MauUUID::UUID::TryParseLenient("123e4567e89b12d3a4564266141740000", uuid)); // 33 digits
+    REQUIRE_FALSE(MauUUID::UUID::TryParseLenient("123e4567e89b12d3a45642661417400g", uuid)); // invalid char
+    REQUIRE_FALSE(MauUUID::UUID::TryParseLenient("", uuid));
+    REQUIRE(uuid == before); // output untouched on failure
+}
+
+TEST_CASE("UUID ParseAny detects and parses all supported formats", "[uuid][parse][any]")
+{
+    MauUUID::UUID const expected{ "123e4567-e89b-12d3-a456-426614174000" };
+
+    std::string_view constexpr formats[]
+    {
+        "123e4567-e89b-12d3-a456-426614174000",
+        "123E4567-E89B-12D3-A456-426614174000",
+        "{123e4567-e89b-12d3-a456-426614174000}",
+        "urn:uuid:123e4567-e89b-12d3-a456-426614174000",
+        "URN:UUID:123e4567-e89b-12d3-a456-426614174000",
+        "123e4567e89b12d3a456426614174000",
+        "Ej5FZ+ibEtOkVkJmFBdAAA==",
+        "Ej5FZ+ibEtOkVkJmFBdAAA",
+        "Ej5FZ-ibEtOkVkJmFBdAAA",
+    };
+
+    for (auto const str : formats)
+    {
+        INFO(str);
+        auto const parsed{ MauUUID::UUID::ParseAny(str) };
+        REQUIRE(parsed.has_value());
+        REQUIRE(*parsed == expected);
+    }
+
+    auto const allOnes{ MauUUID::UUID::ParseAny("-____________________w") };
+    REQUIRE(allOnes.has_value());
+    REQUIRE(allOnes->Str() == "fbffffff-ffff-ffff-ffff-ffffffffffff");
+}
+
+TEST_CASE("UUID ParseAny rejects malformed strings", "[uuid][parse][any]")
+{
+    std::string_view constexpr invalid[]
+    {
+        "",
+        "123e4567-e89b-12d3-a456-42661417400z",
+        "123e4567_e89b-12d3-a456-426614174000",
+        "(123e4567-e89b-12d3-a456-426614174000)",
+        "{123e4567-e89b-12d3-a456-426614174000",
+        "urn:uid::123e4567-e89b-12d3-a456-426614174000",
+        "123e4567e89b12d3a45642661417400g",
+        "123e4567-e89b12d3a456426614174000",
+        "Ej5FZ+ibEtOkVkJmFBdAAB", // non-zero padding bits
+        "Ej5FZ+ibEtOkVkJmFBdA*A",
+        "Ej5FZ+ibEtOkVkJmFBdAAA=X",
+        "{123e4567 e89b 12d3 a456 426614174000}",
+    };
+
+    for (auto const str : invalid)
+    {
+        INFO(str);
+        REQUIRE_FALSE(MauUUID::UUID::ParseAny(str).has_value());
+    }
+}
+
+TEST_CASE("UUID ParseAny batch parses a column", "[uuid][parse][any]")
+{
+    std::vector<std::string_view> const column
+    {
+        "123e4567-e89b-12d3-a456-426614174000",
+        "not a uuid",
+        "Ej5FZ+ibEtOkVkJmFBdAAA",
+        "{00000000-0000-0000-0000-000000000000}",
+    };
+    std::vector<std::optional<MauUUID::UUID>> out(column.size());
+
+    REQUIRE(MauUUID::UUID::ParseAny(column, out) == 3);
+    REQUIRE(out[0] == MauUUID::UUID{ column[0] });
+    REQUIRE_FALSE(out[1].has_value());
+    REQUIRE(out[2] == out[0]);
+    REQUIRE(out[3] == MauUUID::null_uuid);
+}
+
+#ifdef MAU_UUID_INSTRUMENTATION
+#include <thread>
+
+namespace
+{
+#if defined(MAU_UUID_USE_RANDOM)
+    auto constexpr ACTIVE_BACKEND{ MauUUID::Instrumentation::Backend::Random };
+    auto constexpr BULK_BACKEND{ ACTIVE_BACKEND };
+#elif defined(_WIN32)
+    auto constexpr ACTIVE_BACKEND{ MauUUID::Instrumentation::Backend::Windows };
+    auto constexpr BULK_BACKEND{ ACTIVE_BACKEND };
+#else
+    auto constexpr ACTIVE_BACKEND{ MauUUID::Instrumentation::Backend::LibUUID };
+    // Bulk Generate reads the OS entropy source directly
+    auto constexpr BULK_BACKEND{ MauUUID::Instrumentation::Backend::SystemEntropy };
+#endif
+}
+
+TEST_CASE("Instrumentation counts generated UUIDs per backend", "[uuid][instrumentation]")
+{
+    using namespace MauUUID::Instrumentation;
+    auto const backend{ static_cast<size_t>(ACTIVE_BACKEND) };
+
+    auto const before{ GetThreadSnapshot() };
+    for (size_t i{ 0 }; i < 100; ++i)
+    {
+        MauUUID::UUID const uuid{};
+        REQUIRE(uuid);
+    }
+    auto const after{ GetThreadSnapshot() };
+
+    REQUIRE(after.generated[backend] - before.generated[backend] == 100);
+    for (size_t i{ 0 }; i < BACKEND_COUNT; ++i)
+    {
+        if (i != backend)
+        {
+            REQUIRE(after.generated[i] == before.generated[i]);
+        }
+    }
+    REQUIRE(after.entropyRequests >= 1);
+
+    std::vector<MauUUID::UUID> bulk(50, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(bulk);
+    auto const afterBulk{ GetThreadSnapshot() };
+    REQUIRE(afterBulk.generated[static_cast<size_t>(BULK_BACKEND)] - after.generated[static_cast<size_t>(BULK_BACKEND)] == 50);
+#if !defined(MAU_UUID_USE_RANDOM) && !defined(_WIN32)
+    // The whole batch comes from one system entropy request
+    REQUIRE(afterBulk.entropyRequests - after.entropyRequests == 1);
+#endif
+}
+
+TEST_CASE("Instrumentation counts parse successes and failures per API", "[uuid][instrumentation]")
+{
+    using namespace MauUUID::Instrumentation;
+    auto const fromString{ static_cast<size_t>(ParseApi::FromString) };
+    auto const lenient{ static_cast<size_t>(ParseApi::FromStringLenient) };
+    auto const stream{ static_cast<size_t>(ParseApi::Stream) };
+    auto const any{ static_cast<size_t>(ParseApi::Any) };
+
+    auto const before{ GetThreadSnapshot() };
+
+    MauUUID::UUID uuid{ MauUUID::null_uuid };
+    REQUIRE(MauUUID::UUID::TryParse("123e4567-e89b-12d3-a456-426614174000", uuid));
+    REQUIRE_FALSE(MauUUID::UUID::TryParse("not-a-uuid", uuid));
+    REQUIRE(MauUUID::UUID::FromString("123e4567-e89b-12d3-a456-426614174000") == uuid);
+
+    REQUIRE(MauUUID::UUID::TryParseLenient("{123e4567e89b12d3a456426614174000}", uuid));
+    REQUIRE_FALSE(MauUUID::UUID::TryParseLenient("123e4567", uuid));
+
+    std::istringstream iss{ "123e4567-e89b-12d3-a456-426614174000 garbage" };
+    iss >> uuid;
+    REQUIRE(iss);
+    iss >> uuid;
+    REQUIRE(!iss);
+
+    REQUIRE(MauUUID::UUID::ParseAny("Ej5FZ+ibEtOkVkJmFBdAAA").has_value());
+    REQUIRE_FALSE(MauUUID::UUID::ParseAny("Ej5FZ+ibEtOkVkJmFBdAA").has_value());
+
+    auto const after{ GetThreadSnapshot() };
+
+    REQUIRE(after.parseSuccess[fromString] - before.parseSuccess[fromString] == 2);
+    REQUIRE(after.parseFailure[fromString] - before.parseFailure[fromString] == 1);
+    REQUIRE(after.parseSuccess[lenient] - before.parseSuccess[lenient] == 1);
+    REQUIRE(after.parseFailure[lenient] - before.parseFailure[lenient] == 1);
+    REQUIRE(after.parseSuccess[stream] - before.parseSuccess[stream] == 1);
+    REQUIRE(after.parseFailure[stream] - before.parseFailure[stream] == 1);
+    REQUIRE(after.parseSuccess[any] - before.parseSuccess[any] == 1);
+    REQUIRE(after.parseFailure[any] - before.parseFailure[any] == 1);
+    REQUIRE(after.generated == before.generated); // parsing must not generate
+}
+
+TEST_CASE("Instrumentation samples latency at the configured interval", "[uuid][instrumentation]")
+{
+    using namespace MauUUID::Instrumentation;
+
+    SetLatencySampleInterval(4);
+    auto const before{ GetThreadSnapshot() };
+    for (size_t i{ 0 }; i < 400; ++i)
+    {
+        MauUUID::UUID const uuid{};
+    }
+    auto const after{ GetThreadSnapshot() };
+    SetLatencySampleInterval(0);
+
+    uint64_t const sampled{ after.generateLatency.count - before.generateLatency.count };
+    REQUIRE(sampled == 100);
+
+    uint64_t bucketTotal{ 0 };
+    for (size_t i{ 0 }; i < HISTOGRAM_BUCKETS; ++i)
+    {
+        bucketTotal += after.generateLatency.buckets[i] - before.generateLatency.buckets[i];
+    }
+    REQUIRE(bucketTotal == sampled);
+
+    auto const idle{ GetThreadSnapshot() };
+    MauUUID::UUID const uuid{};
+    REQUIRE(GetThreadSnapshot().generateLatency.count == idle.generateLatency.count);
+}
+
+TEST_CASE("Instrumentation aggregates live and exited threads", "[uuid][instrumentation]")
+{
+    using namespace MauUUID::Instrumentation;
+    auto const backend{ static_cast<size_t>(ACTIVE_BACKEND) };
+
+    auto const before{ GetSnapshot() };
+
+    std::vector<std::thread> threads;
+    for (size_t t{ 0 }; t < 4; ++t)
+    {
+        threads.emplace_back([]
+        {
+            for (size_t i{ 0 }; i < 250; ++i)
+            {
+                MauUUID::UUID const uuid{};
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto const after{ GetSnapshot() };
+    REQUIRE(after.generated[backend] - before.generated[backend] == 1000);
+}
+
+TEST_CASE("Instrumentation exports Prometheus text", "[uuid][instrumentation]")
+{
+    using namespace MauUUID::Instrumentation;
+
+    SetLatencySampleInterval(1);
+    MauUUID::UUID const uuid{};
+    SetLatencySampleInterval(0);
+
+    std::string const text{ ToPrometheus(GetSnapshot()) };
+
+    REQUIRE(text.find("# TYPE mau_uuid_generated_total counter\n") != std::string::npos);
+    REQUIRE(text.find("mau_uuid_generated_total{backend=\"libuuid\"} ") != std::string::npos);
+    REQUIRE(text.find("mau_uuid_parse_total{api=\"stream\",result=\"failure\"} ") != std::string::npos);
+    REQUIRE(text.find("# TYPE mau_uuid_generate_latency_nanoseconds histogram\n") != std::string::npos);
+    REQUIRE(text.find("mau_uuid_generate_latency_nanoseconds_bucket{le=\"+Inf\"} ") != std::string::npos);
+    REQUIRE(text.find("mau_uuid_parse_latency_nanoseconds_count{api=\"from_string\"} ") != std::string::npos);
+    REQUIRE(text.back() == '\n');
+}
+#endif
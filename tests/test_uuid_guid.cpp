@@ -0,0 +1,75 @@
+#include <catch2/catch_all.hpp>
+#include "uuid.h"
+
+#include <vector>
+
+namespace
+{
+    // new Guid("00112233-4455-6677-8899-aabbccddeeff").ToByteArray()
+    std::array<uint8_t, 16> constexpr GUID_BYTES
+    {
+        0x33, 0x22, 0x11, 0x00,
+        0x55, 0x44,
+        0x77, 0x66,
+        0x88, 0x99,
+        0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+    };
+    std::string_view constexpr GUID_STRING{ "00112233-4455-6677-8899-aabbccddeeff" };
+}
+
+TEST_CASE("UUID FromGuidBytes and ToGuidBytes convert between GUID and RFC byte order", "[uuid][guid]")
+{
+    auto const uuid{ MauUUID::UUID::FromGuidBytes(GUID_BYTES) };
+    REQUIRE(uuid.Str() == GUID_STRING);
+    REQUIRE(uuid.ToGuidBytes() == GUID_BYTES);
+
+    MauUUID::UUID const generated{};
+    REQUIRE(MauUUID::UUID::FromGuidBytes(generated.ToGuidBytes()) == generated);
+}
+
+TEST_CASE("UUID bulk GUID conversion matches the single record conversion", "[uuid][guid]")
+{
+    // Odd sizes exercise the SIMD loops and the scalar tail
+    for (size_t const count : { 0, 1, 2, 3, 16, 17 })
+    {
+        INFO(count);
+
+        std::vector<MauUUID::UUID> uuids(count, MauUUID::null_uuid);
+        MauUUID::UUID::Generate(uuids);
+
+        std::vector<uint8_t> blob(count * 16);
+        MauUUID::UUID::ToGuidBytes(uuids, blob);
+        for (size_t i{ 0 }; i < count; ++i)
+        {
+            auto const expected{ uuids[i].ToGuidBytes() };
+            REQUIRE(std::equal(expected.begin(), expected.end(), blob.begin() + i * 16));
+        }
+
+        std::vector<MauUUID::UUID> roundTrip(count, MauUUID::null_uuid);
+        MauUUID::UUID::FromGuidBytes(blob, roundTrip);
+        REQUIRE(roundTrip == uuids);
+    }
+}
+
+TEST_CASE("UUID SwapGuidByteOrder converts in place in both directions", "[uuid][guid]")
+{
+    size_t constexpr COUNT{ 5 };
+
+    std::vector<uint8_t> blob(COUNT * 16);
+    for (size_t i{ 0 }; i < COUNT; ++i)
+    {
+        std::ranges::copy(GUID_BYTES, blob.begin() + i * 16);
+    }
+    auto const original{ blob };
+
+    MauUUID::UUID::SwapGuidByteOrder(blob);
+    for (size_t i{ 0 }; i < COUNT; ++i)
+    {
+        std::array<uint8_t, 16> record{};
+        std::copy_n(blob.begin() + i * 16, 16, record.begin());
+        REQUIRE(MauUUID::UUID{ record }.Str() == GUID_STRING);
+    }
+
+    MauUUID::UUID::SwapGuidByteOrder(blob);
+    REQUIRE(blob == original);
+}
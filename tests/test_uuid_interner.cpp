@@ -0,0 +1,147 @@
+#include <catch2/catch_all.hpp>
+#include "uuid_interner.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+TEST_CASE("UUIDInterner assigns dense handles in insertion order", "[uuid][interner]")
+{
+    MauUUID::UUIDInterner interner{};
+    std::vector<MauUUID::UUID> uuids(100, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(uuids);
+
+    for (size_t i{ 0 }; i < uuids.size(); ++i)
+    {
+        REQUIRE(interner.Intern(uuids[i]) == i);
+    }
+    for (size_t i{ 0 }; i < uuids.size(); ++i)
+    {
+        REQUIRE(interner.Intern(uuids[i]) == i); // already interned
+        REQUIRE(interner.Find(uuids[i]) == i);
+        REQUIRE(interner.Get(static_cast<uint32_t>(i)) == uuids[i]);
+    }
+
+    REQUIRE(interner.Size() == uuids.size());
+    REQUIRE_FALSE(interner.Find(MauUUID::UUID{}).has_value());
+}
+
+TEST_CASE("UUIDInterner keeps all handles across growth, also for sequential UUIDs", "[uuid][interner]")
+{
+    MauUUID::UUIDInterner interner{};
+
+    // Sequential UUIDs only differ in a few bytes, the table must still spread them
+    size_t constexpr COUNT{ 200'000 };
+    for (uint64_t i{ 0 }; i < COUNT; ++i)
+    {
+        REQUIRE(interner.Intern(MauUUID::UUID{ std::array<uint64_t, 2>{ 0, i } }) == i);
+    }
+    for (uint64_t i{ 0 }; i < COUNT; ++i)
+    {
+        REQUIRE(interner.Find(MauUUID::UUID{ std::array<uint64_t, 2>{ 0, i } }) == i);
+    }
+
+    REQUIRE(interner.Size() == COUNT);
+    REQUIRE(interner.MemoryUsage() >= COUNT * sizeof(MauUUID::UUID));
+}
+
+TEST_CASE("UUIDInterner InternMany handles duplicates within a batch", "[uuid][interner]")
+{
+    MauUUID::UUIDInterner interner{ 16 };
+    std::vector<MauUUID::UUID> uuids(3, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(uuids);
+
+    REQUIRE(interner.Intern(uuids[1]) == 0);
+
+    std::vector<MauUUID::UUID> const batch{ uuids[0], uuids[1], uuids[0], uuids[2], uuids[2] };
+    std::vector<uint32_t> handles(batch.size(), MauUUID::UUIDInterner::INVALID_HANDLE);
+    interner.InternMany(batch, handles);
+
+    REQUIRE(handles == std::vector<uint32_t>{ 1, 0, 1, 2, 2 });
+    REQUIRE(interner.Size() == 3);
+}
+
+TEST_CASE("UUIDInterner InternMany is thread-safe", "[uuid][interner]")
+{
+    MauUUID::UUIDInterner interner{};
+    std::vector<MauUUID::UUID> uuids(20'000, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(uuids);
+
+    // Every thread interns an overlapping half of the UUIDs, in a different order
+    size_t constexpr THREADS{ 4 };
+    std::vector<std::vector<uint32_t>> handles(THREADS, std::vector<uint32_t>(uuids.size() / 2));
+    std::vector<std::vector<MauUUID::UUID>> inputs(THREADS);
+    for (size_t t{ 0 }; t < THREADS; ++t)
+    {
+        size_t const offset{ t * uuids.size() / 8 };
+        inputs[t].assign(uuids.begin() + offset, uuids.begin() + offset + uuids.size() / 2);
+        if (t & 1)
+        {
+            std::ranges::reverse(inputs[t]);
+        }
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t t{ 0 }; t < THREADS; ++t)
+    {
+        threads.emplace_back([&, t]
+        {
+            // Small batches so the threads interleave
+            for (size_t i{ 0 }; i < inputs[t].size(); i += 64)
+            {
+                size_t const count{ std::min<size_t>(64, inputs[t].size() - i) };
+                interner.InternMany(std::span{ inputs[t] }.subspan(i, count), std::span{ handles[t] }.subspan(i, count));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(interner.Size() == uuids.size() / 8 * 3 + uuids.size() / 2);
+    for (size_t t{ 0 }; t < THREADS; ++t)
+    {
+        for (size_t i{ 0 }; i < inputs[t].size(); ++i)
+        {
+            REQUIRE(interner.Get(handles[t][i]) == inputs[t][i]);
+        }
+    }
+}
+
+TEST_CASE("UUIDInterner frozen reads", "[uuid][interner]")
+{
+    MauUUID::UUIDInterner interner{};
+    std::vector<MauUUID::UUID> uuids(10'000, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(uuids);
+
+    std::vector<uint32_t> handles(uuids.size());
+    interner.InternMany(uuids, handles);
+
+    REQUIRE_FALSE(interner.IsFrozen());
+    interner.Freeze();
+    REQUIRE(interner.IsFrozen());
+
+    REQUIRE(interner.Intern(uuids[42]) == handles[42]);
+    REQUIRE(interner.UUIDs().size() == uuids.size());
+    REQUIRE(std::ranges::equal(interner.UUIDs(), uuids));
+
+    std::vector<std::thread> readers;
+    std::atomic<size_t> found{ 0 };
+    for (size_t t{ 0 }; t < 4; ++t)
+    {
+        readers.emplace_back([&]
+        {
+            for (size_t i{ 0 }; i < uuids.size(); ++i)
+            {
+                found += interner.Find(uuids[i]) == handles[i] && interner.Get(handles[i]) == uuids[i];
+            }
+        });
+    }
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    REQUIRE(found == 4 * uuids.size());
+}
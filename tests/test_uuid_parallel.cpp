@@ -0,0 +1,156 @@
+#include <catch2/catch_all.hpp>
+#include "uuid_parallel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Serial executor recording how many tasks it was given
+    struct CountingExecutor final
+    {
+        size_t tasks{ 0 };
+
+        void Run(size_t const taskCount, std::function<void(size_t)> const& task)
+        {
+            tasks += taskCount;
+            MauUUID::parallel::SerialExecutor{}.Run(taskCount, task);
+        }
+    };
+}
+
+TEST_CASE("parallel::Generate fills every element with a unique UUID", "[uuid][parallel]")
+{
+    std::vector<MauUUID::UUID> uuids(100'000, MauUUID::null_uuid);
+    MauUUID::parallel::Generate(uuids);
+
+    REQUIRE(std::ranges::none_of(uuids, [](auto const& uuid) { return uuid.IsNull(); }));
+
+    std::ranges::sort(uuids);
+    REQUIRE(std::ranges::adjacent_find(uuids) == uuids.end());
+}
+
+TEST_CASE("parallel::Format and Parse are positionally stable", "[uuid][parallel]")
+{
+    std::vector<MauUUID::UUID> uuids(50'000, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(uuids);
+
+    std::vector<std::array<char, 37>> strings(uuids.size());
+    MauUUID::parallel::Format(uuids, strings);
+
+    for (size_t i{ 0 }; i < uuids.size(); ++i)
+    {
+        char expected[37]{};
+        uuids[i].CStr(expected);
+        REQUIRE(std::strcmp(strings[i].data(), expected) == 0);
+    }
+
+    std::vector<std::string_view> views;
+    views.reserve(strings.size());
+    for (auto const& str : strings)
+    {
+        views.emplace_back(str.data(), 36);
+    }
+    views[123] = "not a uuid";
+
+    std::vector<std::optional<MauUUID::UUID>> parsed(views.size());
+    REQUIRE(MauUUID::parallel::Parse(views, parsed) == uuids.size() - 1);
+
+    for (size_t i{ 0 }; i < uuids.size(); ++i)
+    {
+        if (i == 123)
+        {
+            REQUIRE_FALSE(parsed[i].has_value());
+            continue;
+        }
+        REQUIRE(parsed[i] == uuids[i]);
+    }
+}
+
+TEST_CASE("parallel::Hash matches std::hash per element", "[uuid][parallel]")
+{
+    std::vector<MauUUID::UUID> uuids(20'000, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(uuids);
+
+    std::vector<size_t> hashes(uuids.size());
+    MauUUID::parallel::Hash(uuids, hashes);
+
+    std::vector<size_t> byteHashes(uuids.size());
+    MauUUID::parallel::Hash<MauUUID::UUIDHashBytePerByte>(uuids, byteHashes);
+
+    for (size_t i{ 0 }; i < uuids.size(); ++i)
+    {
+        REQUIRE(hashes[i] == std::hash<MauUUID::UUID>{}(uuids[i]));
+        REQUIRE(byteHashes[i] == MauUUID::UUIDHashBytePerByte{}(uuids[i]));
+    }
+}
+
+TEST_CASE("parallel output does not depend on the executor", "[uuid][parallel]")
+{
+    std::vector<MauUUID::UUID> uuids(10'000, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(uuids);
+
+    std::vector<size_t> serial(uuids.size());
+    CountingExecutor counting{};
+    MauUUID::parallel::Hash(uuids, serial, counting);
+    REQUIRE(counting.tasks == (uuids.size() + MauUUID::parallel::CHUNK_SIZE - 1) / MauUUID::parallel::CHUNK_SIZE);
+
+    for (size_t threads : { 1, 2, 4 })
+    {
+        MauUUID::parallel::ThreadPool pool{ threads };
+        REQUIRE(pool.ThreadCount() == threads);
+
+        std::vector<size_t> hashes(uuids.size());
+        MauUUID::parallel::Hash(uuids, hashes, pool);
+        REQUIRE(hashes == serial);
+    }
+}
+
+TEST_CASE("ThreadPool runs every task exactly once, also when nested", "[uuid][parallel]")
+{
+    MauUUID::parallel::ThreadPool pool{ 4 };
+
+    for (size_t round{ 0 }; round < 50; ++round)
+    {
+        std::vector<std::atomic<size_t>> runs(64);
+        pool.Run(runs.size(), [&](size_t const i)
+        {
+            // Nested runs execute inline instead of deadlocking
+            pool.Run(4, [&](size_t) { runs[i].fetch_add(1); });
+        });
+
+        REQUIRE(std::ranges::all_of(runs, [](auto const& count) { return count.load() == 4; }));
+    }
+}
+
+#ifdef MAU_UUID_INSTRUMENTATION
+// ctest runs every test case in its own process, so here the instrumentation registry is first used by the pool's threads.
+// The pool is a function local static like DefaultPool() and is destroyed after the registry at exit, its threads must still be able to retire their counters.
+TEST_CASE("Instrumentation outlives a static pool", "[uuid][parallel][instrumentation]")
+{
+    static MauUUID::parallel::ThreadPool pool{ 4 };
+
+    auto const before{ MauUUID::Instrumentation::GetSnapshot() };
+
+    // Small sleeping tasks so every pool thread picks up work and records into its own counters
+    size_t constexpr TASKS{ 64 };
+    pool.Run(TASKS, [](size_t)
+    {
+        std::vector<MauUUID::UUID> uuids(4, MauUUID::null_uuid);
+        MauUUID::parallel::Generate(uuids, pool);
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+    });
+
+    auto const after{ MauUUID::Instrumentation::GetSnapshot() };
+    uint64_t generated{ 0 };
+    for (size_t i{ 0 }; i < MauUUID::Instrumentation::BACKEND_COUNT; ++i)
+    {
+        generated += after.generated[i] - before.generated[i];
+    }
+    REQUIRE(generated == TASKS * 4);
+}
+#endif
@@ -0,0 +1,125 @@
+#include <catch2/catch_all.hpp>
+#include "uuid_views.h"
+
+#include <algorithm>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Callable generator handing out sequential UUIDs
+    struct CountingGenerator final
+    {
+        uint64_t next{ 1 };
+
+        MauUUID::UUID operator()() noexcept
+        {
+            return MauUUID::UUID{ std::array<uint64_t, 2>{ 0, next++ } };
+        }
+    };
+
+    // Bulk generator recording how often it is asked to refill
+    struct TrackingBulkGenerator final
+    {
+        size_t* pRefills;
+
+        void Generate(std::span<MauUUID::UUID> const out) noexcept
+        {
+            ++*pRefills;
+            MauUUID::UUID::Generate(out);
+        }
+    };
+}
+
+TEST_CASE("UUID bulk Generate fills every element with a unique UUID", "[uuid][generate]")
+{
+    std::vector<MauUUID::UUID> uuids(10'000, MauUUID::null_uuid);
+    MauUUID::UUID::Generate(uuids);
+
+    REQUIRE(std::ranges::none_of(uuids, [](auto const& uuid) { return uuid.IsNull(); }));
+    // Random version 4, RFC 4122 variant
+    REQUIRE(std::ranges::all_of(uuids, [](auto const& uuid) { return (uuid.Data()[6] & 0xF0) == 0x40 && (uuid.Data()[8] & 0xC0) == 0x80; }));
+
+    std::ranges::sort(uuids);
+    REQUIRE(std::ranges::adjacent_find(uuids) == uuids.end());
+}
+
+TEST_CASE("views::generate streams unique UUIDs", "[uuid][views]")
+{
+    static_assert(std::ranges::input_range<decltype(MauUUID::views::generate())>);
+    static_assert(std::ranges::view<decltype(MauUUID::views::generate())>);
+
+    std::vector<MauUUID::UUID> uuids;
+    for (auto const& uuid : MauUUID::views::generate() | std::views::take(1'000))
+    {
+        uuids.push_back(uuid);
+    }
+
+    REQUIRE(uuids.size() == 1'000);
+    std::ranges::sort(uuids);
+    REQUIRE(std::ranges::adjacent_find(uuids) == uuids.end());
+}
+
+TEST_CASE("views::generate keeps order across chunk boundaries with a callable generator", "[uuid][views]")
+{
+    uint64_t expected{ 1 };
+    for (auto const& uuid : MauUUID::views::generate<8>(CountingGenerator{}) | std::views::take(100))
+    {
+        REQUIRE(uuid.Data64()[1] == expected++);
+    }
+    REQUIRE(expected == 101);
+}
+
+TEST_CASE("views::generate refills through the bulk path one chunk at a time", "[uuid][views]")
+{
+    size_t refills{ 0 };
+    auto view{ MauUUID::views::generate<64>(TrackingBulkGenerator{ &refills }) };
+    REQUIRE(refills == 0); // lazy
+
+    size_t count{ 0 };
+    for ([[maybe_unused]] auto const& uuid : std::move(view) | std::views::take(130))
+    {
+        ++count;
+    }
+
+    REQUIRE(count == 130);
+    REQUIRE(refills == 3);
+
+    // Exactly one chunk: no extra refill for the element after the last one taken
+    refills = 0;
+    count = 0;
+    for ([[maybe_unused]] auto const& uuid : MauUUID::views::generate<64>(TrackingBulkGenerator{ &refills }) | std::views::take(64))
+    {
+        ++count;
+    }
+
+    REQUIRE(count == 64);
+    REQUIRE(refills == 1);
+}
+
+TEST_CASE("views::generate skips over chunks that are never read", "[uuid][views]")
+{
+    // drop advances without dereferencing, the skipped UUIDs are still consumed in order
+    uint64_t expected{ 101 };
+    for (auto const& uuid : MauUUID::views::generate<8>(CountingGenerator{}) | std::views::drop(100) | std::views::take(20))
+    {
+        REQUIRE(uuid.Data64()[1] == expected++);
+    }
+    REQUIRE(expected == 121);
+}
+
+TEST_CASE("views::generate composes with transform", "[uuid][views]")
+{
+    auto strings{ MauUUID::views::generate()
+        | std::views::transform([](MauUUID::UUID const& uuid) { return uuid.Str(); })
+        | std::views::take(10) };
+
+    size_t count{ 0 };
+    for (std::string const& str : strings)
+    {
+        REQUIRE(MauUUID::UUID::IsValidString(str));
+        ++count;
+    }
+    REQUIRE(count == 10);
+}